@@ -67,6 +67,4 @@
 #define FS_FILE_SEPARATOR "/"
 #endif
 
-#define parsync _Pragma("omp parallel for") for
-
 #endif
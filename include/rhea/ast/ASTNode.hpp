@@ -19,10 +19,15 @@
 #ifndef RHEA_AST_NODE_HPP
 #define RHEA_AST_NODE_HPP
 
+#include <functional>
 #include <memory>
 #include <rhea/core/DynamicObject.hpp>
 #include <rhea/parser/Token.hpp>
 
+class ASTNode;
+
+using ASTChildCallback = std::function<void(std::shared_ptr<ASTNode>&)>;
+
 class ASTNode {
    protected:
     std::shared_ptr<Token> address = nullptr;
@@ -34,6 +39,11 @@ class ASTNode {
     virtual ~ASTNode() = default;
     virtual DynamicObject visit(SymbolTable& symbols) = 0;
 
+    // Hands every child slot, including empty ones, to the callback, which
+    // may replace it in place. Leaf nodes have nothing to enumerate.
+    virtual void forEachChild(const ASTChildCallback&) {
+    }
+
     [[nodiscard]]
     const std::shared_ptr<Token>& getAddress() const {
         return this->address;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_COMPLETION_HPP
+#define RHEA_AST_COMPLETION_HPP
+
+#include <cstdint>
+#include <memory>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/parser/Token.hpp>
+
+enum class CompletionType : uint8_t { NORMAL, BREAK, CONTINUE, RETURN };
+
+// Per-thread completion record for break, continue and ret. Statements set
+// it and return normally; blocks, loops and the VM stop at the first abrupt
+// completion and consume the kinds they own, so only genuine throws and
+// runtime errors unwind the C++ stack.
+class Completion final {
+   private:
+    static inline thread_local CompletionType type = CompletionType::NORMAL;
+    static thread_local std::shared_ptr<Token> origin;
+
+   public:
+    static bool isAbrupt() {
+        return Completion::type != CompletionType::NORMAL;
+    }
+
+    static CompletionType current() {
+        return Completion::type;
+    }
+
+    static bool consume(CompletionType kind) {
+        if(Completion::type != kind) return false;
+
+        Completion::type = CompletionType::NORMAL;
+        return true;
+    }
+
+    static void signal(CompletionType kind,
+                       const std::shared_ptr<Token>& address);
+    static void raise(const DynamicObject& value);
+};
+
+#endif
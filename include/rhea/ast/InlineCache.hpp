@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_INLINE_CACHE_HPP
+#define RHEA_AST_INLINE_CACHE_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/SymbolTable.hpp>
+
+// Monomorphic cache for a single call site. An entry stays valid while the
+// global symbol table it was resolved against (by serial) is the one in use
+// and no callable binding has been replaced since (see
+// SymbolTable::getEpoch). Contended accesses simply miss instead of waiting.
+class InlineCache final {
+   private:
+    std::mutex mtx;
+    uint64_t root;
+    uint64_t epoch;
+    DynamicObject target;
+
+   public:
+    InlineCache() : mtx(), root(0), epoch(0), target() {
+    }
+
+    InlineCache(const InlineCache&) = delete;
+    InlineCache& operator=(const InlineCache&) = delete;
+
+    bool lookup(const SymbolTable& symbols, DynamicObject& result);
+    void update(const SymbolTable& symbols, uint64_t resolvedEpoch,
+                const DynamicObject& value);
+};
+
+#endif
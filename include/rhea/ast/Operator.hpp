@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_OPERATOR_HPP
+#define RHEA_AST_OPERATOR_HPP
+
+#include <cstdint>
+
+enum class BinaryOperator : uint8_t {
+    ASSIGN,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    RDIV,
+    MOD,
+    BIT_AND,
+    BIT_OR,
+    BIT_XOR,
+    SHIFT_LEFT,
+    SHIFT_RIGHT,
+    LOGIC_AND,
+    LOGIC_OR,
+    EQUAL,
+    NOT_EQUAL,
+    LESS,
+    GREATER,
+    LESS_EQUAL,
+    GREATER_EQUAL,
+    NIL_COALESCE,
+    REGEX_MATCH,
+    REGEX_NOT_MATCH,
+    VECTOR_ADD,
+    VECTOR_SUB,
+    VECTOR_MUL,
+    VECTOR_DIV,
+    VECTOR_REM,
+    VECTOR_BIT_AND,
+    VECTOR_BIT_OR,
+    VECTOR_BIT_XOR,
+    VECTOR_SHIFT_LEFT,
+    VECTOR_SHIFT_RIGHT
+};
+
+enum class UnaryOperator : uint8_t { PLUS, NEGATE, NOT, INVERT, LENGTH };
+
+enum class ReductionOperator : uint8_t { ADD, MUL, MIN, MAX, APPEND };
+
+#endif
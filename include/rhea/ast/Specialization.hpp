@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_SPECIALIZATION_HPP
+#define RHEA_AST_SPECIALIZATION_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Type-feedback state carried by self-specializing nodes. A node starts
+// UNINITIALIZED, commits to a specialized fast path after its first
+// evaluation and falls back to GENERIC for good on the first operand type
+// that path cannot handle.
+enum class SpecializationState : uint8_t {
+    UNINITIALIZED,
+    NUMBER,
+    STRING,
+    GENERIC
+};
+
+enum class SpecializedNode : uint8_t {
+    NUMBER_BINARY,
+    STRING_BINARY,
+    NUMBER_UNARY,
+    ARRAY_INDEX_NUMBER,
+    CALL_SITE
+};
+
+class Specialization final {
+   private:
+    static constexpr size_t nodeCount = 5;
+
+    static inline bool profiling = false;
+    static inline std::array<std::atomic<uint64_t>, nodeCount> rewrites = {};
+    static inline std::array<std::atomic<uint64_t>, nodeCount> hits = {};
+    static inline std::array<std::atomic<uint64_t>, nodeCount> misses = {};
+
+    static void count(std::array<std::atomic<uint64_t>, nodeCount>& counters,
+                      SpecializedNode node) {
+        if(Specialization::profiling)
+            counters[static_cast<size_t>(node)].fetch_add(
+                1, std::memory_order_relaxed);
+    }
+
+   public:
+    static void setProfiling(bool enabled);
+    static bool isProfiling();
+
+    static void rewrite(SpecializedNode node) {
+        Specialization::count(Specialization::rewrites, node);
+    }
+
+    static void hit(SpecializedNode node) {
+        Specialization::count(Specialization::hits, node);
+    }
+
+    static void miss(SpecializedNode node) {
+        Specialization::count(Specialization::misses, node);
+    }
+
+    static void report();
+};
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_TAIL_CALL_HPP
+#define RHEA_AST_TAIL_CALL_HPP
+
+#include <memory>
+#include <rhea/core/DynamicObject.hpp>
+#include <vector>
+
+class FunctionDeclarationExpression;
+
+// Per-thread pending call for call sites in tail position. Instead of
+// invoking the callee, the site parks it here with its arguments and
+// returns nil through nodes that only pass values along, and the
+// enclosing FunctionDeclarationExpression::call runs it in its own native
+// frame. Recursion through tail calls therefore keeps a constant stack.
+class TailCall final {
+   private:
+    static inline thread_local bool pending = false;
+    static thread_local std::shared_ptr<FunctionDeclarationExpression> callee;
+    static thread_local std::vector<DynamicObject> arguments;
+
+   public:
+    static bool isPending() {
+        return TailCall::pending;
+    }
+
+    static void schedule(
+        std::shared_ptr<FunctionDeclarationExpression> function,
+        std::vector<DynamicObject> args);
+    static std::shared_ptr<FunctionDeclarationExpression> take(
+        std::vector<DynamicObject>& args);
+};
+
+#endif
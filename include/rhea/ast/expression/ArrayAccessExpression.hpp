@@ -19,8 +19,10 @@
 #ifndef RHEA_AST_EXPR_ARRAY_ACCESS_HPP
 #define RHEA_AST_EXPR_ARRAY_ACCESS_HPP
 
+#include <atomic>
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/Specialization.hpp>
 #include <rhea/ast/TerminativeSignal.hpp>
 #include <vector>
 
@@ -28,19 +30,26 @@ class ArrayAccessExpression final : public ASTNode {
    private:
     std::shared_ptr<ASTNode> array;
     std::shared_ptr<ASTNode> index;
+    std::atomic<SpecializationState> state;
 
    public:
     explicit ArrayAccessExpression(std::shared_ptr<Token> _address,
                                    std::shared_ptr<ASTNode> _array,
                                    std::shared_ptr<ASTNode> _index)
-        : array(std::move(_array)), index(std::move(_index)) {
+        : array(std::move(_array)),
+          index(std::move(_index)),
+          state(SpecializationState::UNINITIALIZED) {
         this->address = std::move(_address);
     }
 
-    ASTNode* getArrayExpression() const;
-    ASTNode* getIndexExpression() const;
+    const std::shared_ptr<ASTNode>& getArrayExpression() const;
+    const std::shared_ptr<ASTNode>& getIndexExpression() const;
 
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
+
+    static DynamicObject access(std::shared_ptr<Token> address,
+                                DynamicObject origin, DynamicObject idx);
 };
 
 #endif
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_EXPR_ARRAY_ASSIGNMENT_HPP
+#define RHEA_AST_EXPR_ARRAY_ASSIGNMENT_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/SymbolTable.hpp>
+
+class ArrayAssignmentExpression final : public ASTNode {
+   private:
+    std::shared_ptr<ASTNode> array;
+    std::shared_ptr<ASTNode> index;
+    std::shared_ptr<ASTNode> value;
+
+   public:
+    explicit ArrayAssignmentExpression(std::shared_ptr<Token> _address,
+                                       std::shared_ptr<ASTNode> _array,
+                                       std::shared_ptr<ASTNode> _index,
+                                       std::shared_ptr<ASTNode> _value)
+        : array(std::move(_array)),
+          index(std::move(_index)),
+          value(std::move(_value)) {
+        this->address = std::move(_address);
+    }
+
+    const std::shared_ptr<ASTNode>& getArrayExpression() const;
+    const std::shared_ptr<ASTNode>& getIndexExpression() const;
+    const std::shared_ptr<ASTNode>& getValue() const;
+
+    [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
+
+    static void assign(const std::shared_ptr<Token>& address,
+                       DynamicObject& array, const DynamicObject& index,
+                       const DynamicObject& value);
+};
+
+#endif
@@ -35,7 +35,10 @@ class ArrayExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::vector<std::shared_ptr<ASTNode>>& getElements() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
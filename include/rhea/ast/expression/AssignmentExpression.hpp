@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_EXPR_ASSIGNMENT_HPP
+#define RHEA_AST_EXPR_ASSIGNMENT_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/expression/VariableAccessExpression.hpp>
+#include <rhea/core/SymbolTable.hpp>
+
+class AssignmentExpression final : public ASTNode {
+   private:
+    std::shared_ptr<VariableAccessExpression> variable;
+    std::shared_ptr<ASTNode> value;
+
+   public:
+    explicit AssignmentExpression(
+        std::shared_ptr<Token> _address,
+        std::shared_ptr<VariableAccessExpression> _variable,
+        std::shared_ptr<ASTNode> _value)
+        : variable(std::move(_variable)), value(std::move(_value)) {
+        this->address = std::move(_address);
+    }
+
+    const std::shared_ptr<VariableAccessExpression>& getVariable() const;
+    const std::shared_ptr<ASTNode>& getValue() const;
+
+    [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
+};
+
+#endif
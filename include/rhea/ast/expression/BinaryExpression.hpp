@@ -19,26 +19,58 @@
 #ifndef RHEA_AST_EXPR_BINARY_HPP
 #define RHEA_AST_EXPR_BINARY_HPP
 
+#include <atomic>
 #include <cmath>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/Operator.hpp>
+#include <rhea/ast/Specialization.hpp>
 #include <rhea/core/DynamicObject.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
 class BinaryExpression final : public ASTNode {
    private:
+    using NumberHandler = DynamicObject (*)(double lhs, double rhs);
+    using StringHandler = DynamicObject (*)(const std::string& lhs,
+                                            const std::string& rhs);
+
     std::shared_ptr<ASTNode> left;
     std::shared_ptr<ASTNode> right;
-    std::string op;
+    BinaryOperator op;
+    std::atomic<SpecializationState> state;
+    std::atomic<NumberHandler> numberPath;
+    std::atomic<StringHandler> stringPath;
+
+    void specialize(const DynamicObject& lValue, const DynamicObject& rValue);
+    void deoptimize(SpecializedNode node);
+
+    static NumberHandler numberHandler(BinaryOperator op);
+    static StringHandler stringHandler(BinaryOperator op);
 
    public:
     explicit BinaryExpression(std::shared_ptr<Token> _address,
                               std::shared_ptr<ASTNode> _left, std::string _op,
                               std::shared_ptr<ASTNode> _right)
-        : left(std::move(_left)), right(std::move(_right)), op(_op) {
+        : left(std::move(_left)),
+          right(std::move(_right)),
+          op(BinaryExpression::resolveOperator(_op)),
+          state(SpecializationState::UNINITIALIZED),
+          numberPath(nullptr),
+          stringPath(nullptr) {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getLeft() const;
+    BinaryOperator getOperator() const;
+    const std::shared_ptr<ASTNode>& getRight() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
+
+    static BinaryOperator resolveOperator(const std::string& image);
+    static DynamicObject applyOperator(const std::shared_ptr<Token>& address,
+                                       BinaryOperator op,
+                                       const DynamicObject& lValue,
+                                       const DynamicObject& rValue);
 };
 
 #endif
\ No newline at end of file
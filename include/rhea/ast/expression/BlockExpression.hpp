@@ -35,7 +35,10 @@ class BlockExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::vector<std::shared_ptr<ASTNode>>& getStatements() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
\ No newline at end of file
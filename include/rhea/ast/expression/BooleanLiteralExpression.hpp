@@ -34,6 +34,8 @@ class BooleanLiteralExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    bool getValue() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
 };
 
@@ -22,6 +22,7 @@
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
 #include <rhea/ast/TerminativeSignal.hpp>
+#include <rhea/core/SymbolTable.hpp>
 #include <rhea/parser/Token.hpp>
 #include <vector>
 
@@ -31,6 +32,7 @@ class CatchHandleExpression final : public ASTNode {
     std::shared_ptr<ASTNode> handleBlock;
     std::shared_ptr<Token> handler;
     std::shared_ptr<ASTNode> finalBlock;
+    std::shared_ptr<const SymbolLayout> handlerLayout;
 
    public:
     explicit CatchHandleExpression(std::shared_ptr<Token> _address,
@@ -41,11 +43,19 @@ class CatchHandleExpression final : public ASTNode {
         : catchBlock(std::move(_catchBlock)),
           handleBlock(std::move(_handleBlock)),
           handler(std::move(_handler)),
-          finalBlock(std::move(_finalBlock)) {
+          finalBlock(std::move(_finalBlock)),
+          handlerLayout(std::make_shared<const SymbolLayout>(
+              SymbolLayout{this->handler->getImage()})) {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getCatchBlock() const;
+    const std::shared_ptr<ASTNode>& getHandleBlock() const;
+    const std::shared_ptr<Token>& getHandler() const;
+    const std::shared_ptr<ASTNode>& getFinalBlock() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
@@ -21,7 +21,9 @@
 
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/InlineCache.hpp>
 #include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+#include <rhea/ast/expression/VariableAccessExpression.hpp>
 #include <rhea/core/DynamicObject.hpp>
 #include <rhea/core/SymbolTable.hpp>
 #include <string>
@@ -31,16 +33,35 @@ class FunctionCallExpression final : public ASTNode {
    private:
     std::shared_ptr<ASTNode> callable;
     std::vector<std::shared_ptr<ASTNode>> arguments;
+    VariableAccessExpression* callee;
+    InlineCache cache;
+    bool tail;
+
+    DynamicObject resolve(SymbolTable& symbols);
 
    public:
     explicit FunctionCallExpression(
         std::shared_ptr<Token> _address, std::shared_ptr<ASTNode> _callable,
         std::vector<std::shared_ptr<ASTNode>> _arguments)
-        : callable(std::move(_callable)), arguments(std::move(_arguments)) {
+        : callable(std::move(_callable)),
+          arguments(std::move(_arguments)),
+          callee(dynamic_cast<VariableAccessExpression*>(this->callable.get())),
+          cache(),
+          tail(false) {
         this->address = std::move(_address);
     }
 
+    FunctionCallExpression(const FunctionCallExpression&) = delete;
+    FunctionCallExpression& operator=(const FunctionCallExpression&) = delete;
+
+    const std::shared_ptr<ASTNode>& getCallable() const;
+    const std::vector<std::shared_ptr<ASTNode>>& getArguments() const;
+    bool isTailCall() const;
+
+    void setTailCall(bool _tail);
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
\ No newline at end of file
@@ -22,27 +22,50 @@
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
 #include <rhea/ast/TerminativeSignal.hpp>
+#include <rhea/core/SymbolTable.hpp>
 #include <rhea/parser/Token.hpp>
 #include <string>
 #include <vector>
 
+class Bytecode;
+
 class FunctionDeclarationExpression final : public ASTNode {
    private:
     std::vector<std::shared_ptr<Token>> parameters;
     std::shared_ptr<ASTNode> body;
+    std::shared_ptr<Bytecode> bytecode;
+    std::shared_ptr<const SymbolLayout> layout;
+    std::shared_ptr<SymbolTable> closure;
+    bool capturing;
+
+    static std::shared_ptr<const SymbolLayout> parameterLayout(
+        const std::vector<std::shared_ptr<Token>>& parameters);
+
+    DynamicObject invoke(const SymbolTable& symbols,
+                         const std::vector<DynamicObject>& args);
 
    public:
     explicit FunctionDeclarationExpression(
         std::shared_ptr<Token> _address,
         std::vector<std::shared_ptr<Token>> _parameters,
         std::shared_ptr<ASTNode> _body)
-        : parameters(std::move(_parameters)), body(std::move(_body)) {
+        : parameters(std::move(_parameters)),
+          body(std::move(_body)),
+          bytecode(nullptr),
+          layout(parameterLayout(this->parameters)),
+          closure(nullptr),
+          capturing(false) {
         this->address = std::move(_address);
     }
 
     explicit FunctionDeclarationExpression(
         FunctionDeclarationExpression&& other) noexcept
-        : parameters(std::move(other.parameters)), body(std::move(other.body)) {
+        : parameters(std::move(other.parameters)),
+          body(std::move(other.body)),
+          bytecode(std::move(other.bytecode)),
+          layout(std::move(other.layout)),
+          closure(std::move(other.closure)),
+          capturing(other.capturing) {
         this->address = std::move(other.address);
     }
 
@@ -54,10 +77,21 @@ class FunctionDeclarationExpression final : public ASTNode {
         FunctionDeclarationExpression&& other) noexcept;
 
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
     DynamicObject call(const SymbolTable& symbols,
                        const std::vector<DynamicObject>& args);
 
     Token getFunctionImage() const;
+    const std::vector<std::shared_ptr<Token>>& getParameters() const;
+    const std::shared_ptr<ASTNode>& getBody() const;
+    const std::shared_ptr<const SymbolLayout>& getLayout() const;
+    bool isCapturing() const;
+
+    void setBytecode(std::shared_ptr<Bytecode> _bytecode);
+    void setLayout(std::shared_ptr<const SymbolLayout> _layout,
+                   bool _capturing);
+
+    std::shared_ptr<FunctionDeclarationExpression> bind(SymbolTable& symbols);
 };
 
 #endif
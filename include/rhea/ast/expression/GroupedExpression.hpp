@@ -34,7 +34,10 @@ class GroupedExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getExpression() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
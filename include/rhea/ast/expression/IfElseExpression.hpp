@@ -39,7 +39,12 @@ class IfElseExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getCondition() const;
+    const std::shared_ptr<ASTNode>& getThenBranch() const;
+    const std::shared_ptr<ASTNode>& getElseBranch() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
@@ -21,21 +21,31 @@
 
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/LockTable.hpp>
 
 class LockExpression final : public ASTNode {
    private:
     std::shared_ptr<Token> variable;
     std::shared_ptr<ASTNode> body;
+    LockMode mode;
 
    public:
     explicit LockExpression(std::shared_ptr<Token> _address,
                             std::shared_ptr<Token> _variable,
-                            std::shared_ptr<ASTNode> _body)
-        : variable(std::move(_variable)), body(std::move(_body)) {
+                            std::shared_ptr<ASTNode> _body,
+                            LockMode _mode = LockMode::WRITE)
+        : variable(std::move(_variable)),
+          body(std::move(_body)),
+          mode(_mode) {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<Token>& getVariable() const;
+    const std::shared_ptr<ASTNode>& getBody() const;
+    LockMode getMode() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
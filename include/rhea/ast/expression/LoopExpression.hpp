@@ -44,7 +44,13 @@ class LoopExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getInitial() const;
+    const std::shared_ptr<ASTNode>& getCondition() const;
+    const std::shared_ptr<ASTNode>& getPostExpression() const;
+    const std::shared_ptr<ASTNode>& getBody() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
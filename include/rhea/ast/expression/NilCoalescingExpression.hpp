@@ -35,7 +35,11 @@ class NilCoalescingExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getLeft() const;
+    const std::shared_ptr<ASTNode>& getRight() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
\ No newline at end of file
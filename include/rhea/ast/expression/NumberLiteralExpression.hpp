@@ -34,6 +34,8 @@ class NumberLiteralExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    double getValue() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols);
 };
 
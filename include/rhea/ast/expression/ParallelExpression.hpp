@@ -26,6 +26,9 @@ class ParallelExpression final : public ASTNode {
    private:
     std::shared_ptr<ASTNode> expression;
 
+    static DynamicObject evaluate(const std::shared_ptr<ASTNode>& expression,
+                                  SymbolTable& symbols);
+
    public:
     explicit ParallelExpression(std::shared_ptr<Token> _address,
                                 std::shared_ptr<ASTNode> _expression)
@@ -33,7 +36,10 @@ class ParallelExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getExpression() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_AST_EXPR_PARALLEL_LOOP_HPP
+#define RHEA_AST_EXPR_PARALLEL_LOOP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/Operator.hpp>
+#include <rhea/ast/expression/AssignmentExpression.hpp>
+#include <rhea/ast/expression/VariableAccessExpression.hpp>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/SymbolTable.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using ParallelReduction =
+    std::pair<ReductionOperator, std::shared_ptr<VariableAccessExpression>>;
+
+// Counted loop whose iterations are split into chunks on the task pool.
+// Every chunk runs in a child scope that holds the counter, the reduction
+// variables and the names the body assigns first, so those are private to
+// it while writes to anything else reach the enclosing scope. The partial
+// results are folded into the outer variables in chunk order afterwards.
+// When an iteration breaks or fails, only the chunks up to the one it ran
+// in are folded, so the reductions match the sequential loop. Writes the
+// dropped chunks made to outer variables are not undone.
+class ParallelLoopExpression final : public ASTNode {
+   private:
+    std::shared_ptr<AssignmentExpression> initial;
+    BinaryOperator comparison;
+    std::shared_ptr<ASTNode> bound;
+    std::shared_ptr<ASTNode> step;
+    bool descending;
+    std::shared_ptr<ASTNode> body;
+    std::vector<ParallelReduction> reductions;
+    std::shared_ptr<const SymbolLayout> layout;
+
+    size_t iterations(double first, double last, double delta) const;
+    SymbolAddress slotOf(const std::string& name) const;
+    DynamicObject identity(ReductionOperator op,
+                           const DynamicObject& initialValue) const;
+    DynamicObject merge(ReductionOperator op, const DynamicObject& left,
+                        const DynamicObject& right) const;
+
+   public:
+    explicit ParallelLoopExpression(
+        std::shared_ptr<Token> _address,
+        std::shared_ptr<AssignmentExpression> _initial,
+        BinaryOperator _comparison, std::shared_ptr<ASTNode> _bound,
+        std::shared_ptr<ASTNode> _step, bool _descending,
+        std::shared_ptr<ASTNode> _body,
+        std::vector<ParallelReduction> _reductions)
+        : initial(std::move(_initial)),
+          comparison(_comparison),
+          bound(std::move(_bound)),
+          step(std::move(_step)),
+          descending(_descending),
+          body(std::move(_body)),
+          reductions(std::move(_reductions)),
+          layout(nullptr) {
+        this->address = std::move(_address);
+
+        SymbolLayout names{this->initial->getVariable()->getName().getImage()};
+        for(const auto& [op, variable] : this->reductions)
+            if(std::find(names.begin(), names.end(),
+                         variable->getName().getImage()) == names.end())
+                names.push_back(variable->getName().getImage());
+
+        this->layout = std::make_shared<const SymbolLayout>(std::move(names));
+    }
+
+    const std::shared_ptr<AssignmentExpression>& getInitial() const;
+    const std::shared_ptr<ASTNode>& getBound() const;
+    const std::shared_ptr<ASTNode>& getStep() const;
+    const std::shared_ptr<ASTNode>& getBody() const;
+    const std::vector<ParallelReduction>& getReductions() const;
+    const std::shared_ptr<const SymbolLayout>& getLayout() const;
+
+    void setLayout(std::shared_ptr<const SymbolLayout> _layout);
+
+    [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
+};
+
+#endif
@@ -27,14 +27,18 @@
 class RegexExpression final : public ASTNode {
    private:
     std::string regExpression;
+    DynamicObject constant;
 
    public:
     explicit RegexExpression(std::shared_ptr<Token> _address,
                              std::string& _regExpression)
-        : regExpression(std::move(_regExpression)) {
+        : regExpression(std::move(_regExpression)), constant() {
         this->address = std::move(_address);
     }
 
+    const std::string& getPattern() const;
+    void setConstant(DynamicObject _constant);
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
 };
 
@@ -27,14 +27,18 @@
 class StringLiteralExpression final : public ASTNode {
    private:
     std::string value;
+    DynamicObject constant;
 
    public:
     explicit StringLiteralExpression(std::shared_ptr<Token> _address,
                                      std::string _value)
-        : value(_value) {
+        : value(_value), constant() {
         this->address = std::move(_address);
     }
 
+    const std::string& getValue() const;
+    void setConstant(DynamicObject _constant);
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
 };
 
@@ -19,23 +19,38 @@
 #ifndef RHEA_AST_EXPR_UNARY_HPP
 #define RHEA_AST_EXPR_UNARY_HPP
 
+#include <atomic>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/Operator.hpp>
+#include <rhea/ast/Specialization.hpp>
 #include <rhea/core/DynamicObject.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
 class UnaryExpression final : public ASTNode {
    private:
-    std::string op;
+    UnaryOperator op;
     std::shared_ptr<ASTNode> expression;
+    std::atomic<SpecializationState> state;
 
    public:
     explicit UnaryExpression(std::shared_ptr<Token> _address, std::string _op,
                              std::shared_ptr<ASTNode> _expression)
-        : op(std::move(_op)), expression(std::move(_expression)) {
+        : op(UnaryExpression::resolveOperator(_op)),
+          expression(std::move(_expression)),
+          state(SpecializationState::UNINITIALIZED) {
         this->address = std::move(_address);
     }
 
+    UnaryOperator getOperator() const;
+    const std::shared_ptr<ASTNode>& getExpression() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
+
+    static UnaryOperator resolveOperator(const std::string& image);
+    static DynamicObject applyOperator(const std::shared_ptr<Token>& address,
+                                       UnaryOperator op,
+                                       const DynamicObject& value);
 };
 
 #endif
@@ -21,20 +21,27 @@
 
 #include <rhea/ast/ASTNode.hpp>
 #include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/SymbolAddress.hpp>
 #include <rhea/core/SymbolTable.hpp>
 #include <string>
 
 class VariableAccessExpression final : public ASTNode {
    private:
     std::shared_ptr<Token> name;
+    SymbolAddress symbolAddress;
 
    public:
     explicit VariableAccessExpression(std::shared_ptr<Token> _name)
-        : name(std::move(_name)) {
+        : name(std::move(_name)), symbolAddress() {
         this->address = std::make_shared<Token>(*this->name);
     }
 
     Token getName() const;
+    const std::shared_ptr<Token>& getNameToken() const;
+
+    const SymbolAddress& getSymbolAddress() const;
+    void setSymbolAddress(SymbolAddress _symbolAddress);
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
 };
 
@@ -22,7 +22,9 @@
 #include <map>
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/SymbolAddress.hpp>
 #include <rhea/parser/Token.hpp>
+#include <vector>
 
 class VariableDeclarationExpression final : public ASTNode {
    private:
@@ -30,6 +32,8 @@ class VariableDeclarationExpression final : public ASTNode {
              std::pair<std::vector<std::string>, std::shared_ptr<ASTNode>>>
         declarations;
     std::string nativePath;
+    std::vector<std::shared_ptr<Token>> names;
+    std::vector<SymbolAddress> symbolAddresses;
 
    public:
     explicit VariableDeclarationExpression(
@@ -38,14 +42,28 @@ class VariableDeclarationExpression final : public ASTNode {
                  std::pair<std::vector<std::string>, std::shared_ptr<ASTNode>>>
             _declarations,
         std::string _nativePath)
-        : declarations(std::move(_declarations)), nativePath(_nativePath) {
+        : declarations(std::move(_declarations)),
+          nativePath(_nativePath),
+          names({}),
+          symbolAddresses(this->declarations.size()) {
         this->address = std::move(_address);
+
+        for(const auto& [key, value] : this->declarations)
+            this->names.push_back(std::make_shared<Token>(key));
     }
 
+    const std::map<
+        Token, std::pair<std::vector<std::string>, std::shared_ptr<ASTNode>>>&
+    getDeclarations() const;
+    const std::string& getNativePath() const;
+
+    const std::vector<SymbolAddress>& getSymbolAddresses() const;
+    void setSymbolAddresses(std::vector<SymbolAddress> _symbolAddresses);
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
-    static NativeFunction loadNativeFunction(std::string& libName,
-                                             std::string& funcName,
-                                             std::shared_ptr<Token> address);
+    void forEachChild(const ASTChildCallback& callback) override;
+    static std::string loadLibrary(const std::string& libName,
+                                   const std::shared_ptr<Token>& address);
 };
 
 #endif
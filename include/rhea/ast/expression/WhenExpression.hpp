@@ -44,7 +44,14 @@ class WhenExpression final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getExpression() const;
+    const std::vector<
+        std::pair<std::shared_ptr<ASTNode>, std::shared_ptr<ASTNode>>>&
+    getCases() const;
+    const std::shared_ptr<ASTNode>& getDefaultCase() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
@@ -31,7 +31,7 @@ class ContinueStatement final : public ASTNode {
         this->address = std::move(_address);
     }
 
-    [[nodiscard, noreturn]]
+    [[nodiscard]]
     DynamicObject visit(SymbolTable& symbols) override;
 };
 
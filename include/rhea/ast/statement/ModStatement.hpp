@@ -37,8 +37,13 @@ class ModStatement final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<Token>& getName() const;
+    const std::map<std::shared_ptr<Token>, std::shared_ptr<ASTNode>>&
+    getMembers() const;
+
     [[nodiscard]]
     DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
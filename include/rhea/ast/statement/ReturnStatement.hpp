@@ -35,8 +35,11 @@ class ReturnStatement final : public ASTNode {
         this->address = std::move(_address);
     }
 
-    [[nodiscard, noreturn]]
+    const std::shared_ptr<ASTNode>& getExpression() const;
+
+    [[nodiscard]]
     DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
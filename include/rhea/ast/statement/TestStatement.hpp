@@ -40,7 +40,12 @@ class TestStatement final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getTestName() const;
+    const std::shared_ptr<ASTNode>& getTestBody() const;
+    const std::shared_ptr<ASTNode>& getTestAssert() const;
+
     [[nodiscard]] DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
@@ -39,8 +39,12 @@ class UseStatement final : public ASTNode {
         this->address = std::move(_address);
     }
 
+    const std::shared_ptr<ASTNode>& getLibraryName() const;
+    const std::shared_ptr<ASTNode>& getLibraryVersion() const;
+
     [[nodiscard]]
     DynamicObject visit(SymbolTable& symbols) override;
+    void forEachChild(const ASTChildCallback& callback) override;
 };
 
 #endif
@@ -16,35 +16,29 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#ifndef RHEA_STDLIB_MAPS_HPP
-#define RHEA_STDLIB_MAPS_HPP
+#ifndef RHEA_CALL_FRAME_HPP
+#define RHEA_CALL_FRAME_HPP
 
-#include <zip.h>
+#include <memory>
+#include <rhea/core/SymbolTable.hpp>
+#include <vector>
 
-#include <chisei/neural_network.hpp>
-#include <myshell.hpp>
-#include <string>
-#include <unordered_map>
+class CallFrame final {
+   private:
+    std::shared_ptr<SymbolTable> frame;
 
-#ifndef __TERMUX__
+    static thread_local std::vector<std::shared_ptr<SymbolTable>> pool;
 
-#include <GLFW/glfw3.h>
+   public:
+    explicit CallFrame(std::shared_ptr<const SymbolLayout> layout,
+                       std::shared_ptr<SymbolTable> parent);
+    ~CallFrame();
 
-// GL
-static std::unordered_map<std::string, GLFWwindow*> windowMap;
-static std::unordered_map<std::string, GLFWmonitor*> monitorMap;
-static std::unordered_map<std::string, GLFWcursor*> cursorMap;
+    CallFrame(const CallFrame&) = delete;
+    CallFrame& operator=(const CallFrame&) = delete;
 
-#endif
-
-// Archive
-static std::unordered_map<std::string, zip_t*> zipMap;
-
-// ML
-static std::unordered_map<std::string, std::shared_ptr<chisei::NeuralNetwork>>
-    neuralNetworkMap;
-
-// Sys
-static std::unordered_map<std::string, std::shared_ptr<MyShell>> shellMap;
+    SymbolTable& operator*() const;
+    SymbolTable* operator->() const;
+};
 
 #endif
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_DYNAMIC_CELL_HPP
+#define RHEA_DYNAMIC_CELL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+// Heap storage shared by every DynamicObject that refers to the same string,
+// array, regex or function. The reference count lives in the cell so that a
+// value only needs a single pointer next to its type tag.
+struct DynamicCellBase {
+    std::atomic<uint32_t> references;
+
+    DynamicCellBase() : references(1) {
+    }
+
+    DynamicCellBase(const DynamicCellBase&) = delete;
+    DynamicCellBase& operator=(const DynamicCellBase&) = delete;
+};
+
+template <typename T>
+struct DynamicCell final : DynamicCellBase {
+    T value;
+
+    explicit DynamicCell(T _value)
+        : DynamicCellBase(), value(std::move(_value)) {
+    }
+};
+
+#endif
@@ -19,10 +19,12 @@
 #ifndef RHEA_DYNAMIC_OBJECT_HPP
 #define RHEA_DYNAMIC_OBJECT_HPP
 
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <memory>
 #include <regex>
+#include <rhea/core/DynamicCell.hpp>
 #include <rhea/core/DynamicObjectType.hpp>
 #include <rhea/core/RegexWrapper.hpp>
 #include <rhea/parser/Token.hpp>
@@ -32,6 +34,9 @@
 class DynamicObject;
 class SymbolTable;
 class FunctionDeclarationExpression;
+class HandleTable;
+class NativeBinding;
+class Task;
 
 using NativeFunction = DynamicObject(
 #if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
@@ -42,143 +47,128 @@ using NativeFunction = DynamicObject(
 
 class DynamicObject final {
    private:
+    union Payload {
+        double number;
+        bool boolean;
+        NativeBinding* native;
+        DynamicCellBase* cell;
+        uint64_t handle;
+    };
+
     DynamicObjectType type;
-    bool isLocked;
-    std::string owner;
+    Payload payload;
+
+    bool isHeap() const {
+        return this->type == DynamicObjectType::STRING ||
+               this->type == DynamicObjectType::ARRAY ||
+               this->type == DynamicObjectType::REGEX ||
+               this->type == DynamicObjectType::FUNCTION ||
+               this->type == DynamicObjectType::FUTURE;
+    }
+
+    bool isCounted() const {
+        return this->isHeap() || this->type == DynamicObjectType::HANDLE;
+    }
+
+    template <typename T>
+    T& cell() const {
+        return static_cast<DynamicCell<T>*>(this->payload.cell)->value;
+    }
 
-    std::shared_ptr<FunctionDeclarationExpression> functionValue;
-    std::shared_ptr<std::vector<DynamicObject>> arrayValue;
-    std::shared_ptr<RegexWrapper> regexValue;
-    NativeFunction nativeValue;
-    std::string stringValue;
-    double numberValue;
-    bool boolValue;
+    template <typename T>
+    static void drop(DynamicCellBase* cell) {
+        if(cell->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete static_cast<DynamicCell<T>*>(cell);
+    }
+
+    void retain() const {
+        if(this->isHeap())
+            this->payload.cell->references.fetch_add(
+                1, std::memory_order_relaxed);
+        else if(this->type == DynamicObjectType::HANDLE)
+            DynamicObject::retainHandle(this->payload.handle);
+    }
+
+    static void retainHandle(uint64_t handle);
+    void release();
+
+    DynamicObject(DynamicObjectType _type, uint64_t handle)
+        : type(_type), payload{.handle = handle} {
+    }
+
+    friend class HandleTable;
 
    public:
     DynamicObject(std::shared_ptr<FunctionDeclarationExpression> value)
         : type(DynamicObjectType::FUNCTION),
-          isLocked(false),
-          owner(""),
-          functionValue(std::move(value)),
-          arrayValue(nullptr),
-          regexValue(nullptr),
-          nativeValue(nullptr),
-          stringValue(""),
-          numberValue(0.0),
-          boolValue(false) {
+          payload{
+              .cell = new DynamicCell<
+                  std::shared_ptr<FunctionDeclarationExpression>>(
+                  std::move(value))} {
     }
 
     DynamicObject(std::shared_ptr<RegexWrapper> value)
         : type(DynamicObjectType::REGEX),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(nullptr),
-          regexValue(std::move(value)),
-          nativeValue(nullptr),
-          stringValue(""),
-          numberValue(0.0),
-          boolValue(false) {
+          payload{.cell = new DynamicCell<std::shared_ptr<RegexWrapper>>(
+                      std::move(value))} {
+    }
+
+    DynamicObject(std::shared_ptr<Task> value)
+        : type(DynamicObjectType::FUTURE),
+          payload{.cell = new DynamicCell<std::shared_ptr<Task>>(
+                      std::move(value))} {
     }
 
     DynamicObject(std::shared_ptr<std::vector<DynamicObject>> value)
         : type(DynamicObjectType::ARRAY),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(std::move(value)),
-          regexValue(nullptr),
-          nativeValue(nullptr),
-          stringValue(""),
-          numberValue(0.0),
-          boolValue(false) {
+          payload{.cell = new DynamicCell<
+                       std::shared_ptr<std::vector<DynamicObject>>>(
+                      std::move(value))} {
     }
 
     DynamicObject(std::string value)
         : type(DynamicObjectType::STRING),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(nullptr),
-          regexValue(nullptr),
-          nativeValue(nullptr),
-          stringValue(std::move(value)),
-          numberValue(0.0),
-          boolValue(false) {
+          payload{.cell = new DynamicCell<std::string>(std::move(value))} {
     }
 
     DynamicObject(double value)
-        : type(DynamicObjectType::NUMBER),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(nullptr),
-          regexValue(nullptr),
-          nativeValue(nullptr),
-          stringValue(""),
-          numberValue(value),
-          boolValue(false) {
+        : type(DynamicObjectType::NUMBER), payload{.number = value} {
     }
 
     DynamicObject(bool value)
-        : type(DynamicObjectType::BOOL),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(nullptr),
-          regexValue(nullptr),
-          nativeValue(nullptr),
-          stringValue(""),
-          numberValue(0.0),
-          boolValue(value) {
+        : type(DynamicObjectType::BOOL), payload{.boolean = value} {
     }
 
-    DynamicObject(NativeFunction value)
-        : type(DynamicObjectType::NATIVE),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(nullptr),
-          regexValue(nullptr),
-          nativeValue(value),
-          stringValue(""),
-          numberValue(0.0),
-          boolValue(false) {
+    DynamicObject(NativeBinding* value)
+        : type(DynamicObjectType::NATIVE), payload{.native = value} {
     }
 
-    DynamicObject()
-        : type(DynamicObjectType::NIL),
-          isLocked(false),
-          owner(""),
-          functionValue(nullptr),
-          arrayValue(nullptr),
-          regexValue(nullptr),
-          nativeValue(nullptr),
-          stringValue(""),
-          numberValue(0.0),
-          boolValue(false) {
+    DynamicObject() : type(DynamicObjectType::NIL), payload{.number = 0.0} {
     }
 
     DynamicObject(const DynamicObject& other)
-        : type(other.type),
-          isLocked(false),
-          owner(""),
-          functionValue(other.functionValue),
-          arrayValue(other.arrayValue),
-          regexValue(other.regexValue),
-          nativeValue(other.nativeValue),
-          stringValue(other.stringValue),
-          numberValue(other.numberValue),
-          boolValue(other.boolValue) {
+        : type(other.type), payload(other.payload) {
+        this->retain();
+    }
+
+    DynamicObject(DynamicObject&& other) noexcept
+        : type(other.type), payload(other.payload) {
+        other.type = DynamicObjectType::NIL;
+    }
+
+    ~DynamicObject() {
+        if(this->isCounted()) this->release();
     }
 
     DynamicObject& operator=(const DynamicObject& other);
-    DynamicObject& operator=(DynamicObject&& other);
-    bool operator==(const DynamicObject& other);
-    bool operator!=(const DynamicObject& other);
-    bool booleanEquivalent();
+    DynamicObject& operator=(DynamicObject&& other) noexcept;
+    bool operator==(const DynamicObject& other) const;
+    bool operator!=(const DynamicObject& other) const;
+    bool booleanEquivalent() const;
 
     bool isFunction() const;
+    bool isFuture() const;
+    bool isHandle() const;
     bool isNumber() const;
     bool isNative() const;
     bool isString() const;
@@ -190,7 +180,10 @@ class DynamicObject final {
     std::shared_ptr<FunctionDeclarationExpression> getCallable() const;
     std::shared_ptr<std::vector<DynamicObject>> getArray() const;
     std::shared_ptr<RegexWrapper> getRegex() const;
+    std::shared_ptr<Task> getFuture() const;
     NativeFunction getNativeFunction() const;
+    NativeBinding* getNativeBinding() const;
+    uint64_t getHandle() const;
     const std::string& getString() const;
     double getNumber() const;
     bool getBool() const;
@@ -202,64 +195,75 @@ class DynamicObject final {
                                  SymbolTable& symtab,
                                  std::vector<DynamicObject> args);
 
-    void lock();
-    void unlock();
-
-    bool hasLock();
-    std::string ownerId() const;
-
-    void own(std::string ownerUuid);
+    std::string objectType() const;
+    std::string toString() const;
 
-    std::string objectType();
-    std::string toString();
+    friend DynamicObject operator+(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator+(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator-(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator-(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator/(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator/(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator*(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator*(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator%(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator%(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator<(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator<(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator>(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator>(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator<=(const DynamicObject& left,
+                                    const DynamicObject& right);
 
-    friend DynamicObject operator<=(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator>=(const DynamicObject& left,
+                                    const DynamicObject& right);
 
-    friend DynamicObject operator>=(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator<<(const DynamicObject& left,
+                                    const DynamicObject& right);
 
-    friend DynamicObject operator<<(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator>>(const DynamicObject& left,
+                                    const DynamicObject& right);
 
-    friend DynamicObject operator>>(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator&(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator&(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator|(const DynamicObject& left,
+                                   const DynamicObject& right);
 
-    friend DynamicObject operator|(DynamicObject left, DynamicObject right);
-
-    friend DynamicObject operator^(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator^(const DynamicObject& left,
+                                   const DynamicObject& right);
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Weffc++"
 
-    friend DynamicObject operator&&(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator&&(const DynamicObject& left,
+                                    const DynamicObject& right);
 
-    friend DynamicObject operator||(DynamicObject left, DynamicObject right);
+    friend DynamicObject operator||(const DynamicObject& left,
+                                    const DynamicObject& right);
 
 #pragma GCC diagnostic pop
 
-    DynamicObject vectorAdd(DynamicObject arrayValue);
-    DynamicObject vectorSub(DynamicObject arrayValue);
-    DynamicObject vectorDiv(DynamicObject arrayValue);
-    DynamicObject vectorMul(DynamicObject arrayValue);
-    DynamicObject vectorRem(DynamicObject arrayValue);
-    DynamicObject vectorBitwiseAnd(DynamicObject arrayValue);
-    DynamicObject vectorBitwiseOr(DynamicObject arrayValue);
-    DynamicObject vectorBitwiseXor(DynamicObject arrayValue);
-    DynamicObject vectorShiftLeft(DynamicObject arrayValue);
-    DynamicObject vectorShiftRight(DynamicObject arrayValue);
+    DynamicObject vectorAdd(const DynamicObject& arrayValue) const;
+    DynamicObject vectorSub(const DynamicObject& arrayValue) const;
+    DynamicObject vectorDiv(const DynamicObject& arrayValue) const;
+    DynamicObject vectorMul(const DynamicObject& arrayValue) const;
+    DynamicObject vectorRem(const DynamicObject& arrayValue) const;
+    DynamicObject vectorBitwiseAnd(const DynamicObject& arrayValue) const;
+    DynamicObject vectorBitwiseOr(const DynamicObject& arrayValue) const;
+    DynamicObject vectorBitwiseXor(const DynamicObject& arrayValue) const;
+    DynamicObject vectorShiftLeft(const DynamicObject& arrayValue) const;
+    DynamicObject vectorShiftRight(const DynamicObject& arrayValue) const;
 };
 
+static_assert(sizeof(DynamicObject) <= 16,
+              "DynamicObject must stay a two-word value.");
+
 #endif
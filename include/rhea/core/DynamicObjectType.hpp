@@ -27,7 +27,9 @@ enum class DynamicObjectType {
     ARRAY,
     REGEX,
     FUNCTION,
-    NATIVE
+    NATIVE,
+    FUTURE,
+    HANDLE
 };
 
 #endif
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_HANDLE_TABLE_HPP
+#define RHEA_CORE_HANDLE_TABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <rhea/core/DynamicObject.hpp>
+#include <string>
+
+// What a handle points to. Each native library defines one static kind per
+// type of object it hands out; the kind's address is what makes a handle
+// typed, and destroy() runs once the object is closed or forgotten.
+class HandleKind final {
+   public:
+    const char* name;
+    void (*destroy)(void*);
+};
+
+// Native objects handed out to scripts (threads, archives, windows, ...).
+// A handle is a slot index paired with the slot's generation, so lookups
+// are a bounds check and two loads, and a handle that outlived its slot
+// never resolves to whatever took the slot next.
+//
+// Handles are reference counted by the values that carry them. When the
+// last one drops, the object is destroyed and the slot goes back on a
+// lock-free free list. Slots are grouped in segments that are allocated
+// on demand and never moved or freed.
+class HandleTable final {
+   private:
+    class Slot final {
+       public:
+        std::atomic<uint32_t> generation;
+        std::atomic<uint32_t> references;
+        std::atomic<uint32_t> next;
+        std::atomic<bool> open;
+        std::atomic<const HandleKind*> kind;
+        std::atomic<void*> object;
+
+        Slot()
+            : generation(0),
+              references(0),
+              next(0),
+              open(false),
+              kind(nullptr),
+              object(nullptr) {
+        }
+    };
+
+    static constexpr uint32_t segmentSize = 1024;
+    static constexpr uint32_t segmentCount = 4096;
+
+    static std::atomic<Slot*> segments[segmentCount];
+    static std::atomic<uint64_t> freeList;
+    static std::atomic<uint32_t> used;
+    static std::mutex growth;
+
+    static Slot* slotAt(uint32_t index);
+    static Slot* slotFor(uint64_t id);
+    static uint32_t acquire();
+    static void recycle(uint32_t index);
+
+   public:
+    static DynamicObject create(const HandleKind& kind, void* object);
+    static void* find(const DynamicObject& handle, const HandleKind& kind);
+    static void* take(const DynamicObject& handle, const HandleKind& kind);
+    static void* close(const DynamicObject& handle, const HandleKind& kind);
+
+    static void retain(uint64_t id);
+    static void release(uint64_t id);
+    static std::string describe(uint64_t id);
+
+    static void closeAll();
+};
+
+#endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_LOCK_TABLE_HPP
+#define RHEA_CORE_LOCK_TABLE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+enum class LockMode { READ, WRITE };
+
+// Locks taken by `lock` expressions. A variable is keyed by the scope that
+// owns it and its slot; the key is hashed onto a fixed set of stripes, and
+// each stripe keeps the reader/writer state of the exact variables locked
+// through it, so unrelated variables that share a stripe never wait on each
+// other. Waiters spin for an adaptive number of rounds, then park on the
+// stripe until a lock in it is released.
+//
+// A lock belongs to the task that took it (or to the thread, outside of
+// tasks), so the holder can take it again, and a write lock lets it write
+// to the variable while everyone else waits for it. A read lock does not:
+// awaitWritable() refuses writes from a task that only reads the variable.
+class LockTable final {
+   private:
+    class Entry final {
+       public:
+        const void* scope;
+        uint32_t slot;
+        uint32_t readers;
+        uint32_t writersParked;
+        bool writing;
+    };
+
+    class alignas(64) Stripe final {
+       public:
+        std::mutex mtx;
+        std::condition_variable released;
+        std::vector<Entry> entries;
+        std::atomic<uint32_t> active;
+        std::atomic<uint32_t> releases;
+        uint32_t waiters;
+        std::atomic<uint32_t> spinLimit;
+        std::atomic<uint64_t> reads;
+        std::atomic<uint64_t> writes;
+        std::atomic<uint64_t> contended;
+        std::atomic<uint64_t> parked;
+
+        Stripe()
+            : mtx(),
+              released(),
+              entries(),
+              active(0),
+              releases(0),
+              waiters(0),
+              spinLimit(64),
+              reads(0),
+              writes(0),
+              contended(0),
+              parked(0) {
+        }
+    };
+
+    static constexpr size_t stripeCount = 256;
+
+    static Stripe stripes[stripeCount];
+
+    static Stripe& stripeFor(const void* scope, uint32_t slot);
+    static const void* owner();
+    static bool holds(const void* scope, uint32_t slot, LockMode mode);
+
+    static Entry* find(Stripe& stripe, const void* scope, uint32_t slot);
+    static bool tryAcquire(Stripe& stripe, const void* scope, uint32_t slot,
+                           LockMode mode);
+    static void acquire(Stripe& stripe, const void* scope, uint32_t slot,
+                        LockMode mode);
+    static void release(Stripe& stripe, const void* scope, uint32_t slot,
+                        LockMode mode);
+
+   public:
+    class Guard final {
+       private:
+        const void* scope;
+        uint32_t slot;
+        LockMode mode;
+        bool taken;
+
+       public:
+        Guard(const void* _scope, uint32_t _slot, LockMode _mode);
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    static bool isReading(const void* scope, uint32_t slot);
+    static bool isHolding();
+
+    static bool awaitWritable(const void* scope, uint32_t slot);
+    static void report();
+};
+
+#endif
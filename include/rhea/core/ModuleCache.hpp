@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_MODULE_CACHE_HPP
+#define RHEA_CORE_MODULE_CACHE_HPP
+
+#include <rhea/core/ModuleRegistry.hpp>
+#include <rhea/parser/Token.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Precompiled token streams (.rheac) of source files. A cache is written
+// next to its source, or under $RHEA_PATH/cache when that directory is not
+// writable, and only by `rhea --compile`. It is used as long as it was
+// written by this very build of the interpreter from a source with the
+// same digest; anything else falls back to the tokenizer.
+class ModuleCache final {
+   private:
+    static std::string sharedLocation(const std::string& file);
+
+    static bool read(const std::string& cacheFile,
+                     ModuleRegistry::Module& module,
+                     std::vector<Token>& tokens);
+    static bool decode(std::string_view data, ModuleRegistry::Module& module,
+                       std::vector<Token>& tokens);
+
+   public:
+    static std::vector<Token> load(ModuleRegistry::Module& module);
+    static std::string compile(const std::string& file);
+};
+
+#endif
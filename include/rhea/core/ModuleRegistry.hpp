@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_MODULE_REGISTRY_HPP
+#define RHEA_CORE_MODULE_REGISTRY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Source files loaded so far. A file is known by its device and inode (its
+// canonical path where there are none), and a repeated load is a stat and
+// a map lookup as long as its size and modification time have not moved.
+// Different files of the same size are hashed to tell whether one is a
+// copy of the other, and only then; each file is hashed at most once, and
+// never while the registry is locked.
+class ModuleRegistry final {
+   public:
+    class Module final {
+       public:
+        std::string path;
+        std::string identity;
+        uintmax_t size;
+        std::string digest;
+        std::once_flag hashed;
+
+        Module(std::string _path, std::string _identity, uintmax_t _size)
+            : path(std::move(_path)),
+              identity(std::move(_identity)),
+              size(_size),
+              digest(),
+              hashed() {
+        }
+    };
+
+   private:
+    class Entry final {
+       public:
+        uintmax_t size;
+        int64_t modified;
+        std::shared_ptr<Module> module;
+    };
+
+    static std::unordered_map<std::string, Entry> files;
+    static std::unordered_multimap<uintmax_t, std::shared_ptr<Module>> sizes;
+    static std::mutex mutex;
+
+    static void forget(const std::shared_ptr<Module>& module);
+    static bool isCurrent(const std::string& identity, uintmax_t size,
+                          int64_t modified);
+
+   public:
+    static std::shared_ptr<Module> claim(const std::string& file);
+    static std::string digest(Module& module);
+};
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_NATIVE_BINDING_HPP
+#define RHEA_CORE_NATIVE_BINDING_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/NativeModule.hpp>
+#include <string>
+#include <unordered_map>
+
+// A function imported from a native library. Libraries exporting a
+// registration table (see NativeModule.hpp) have all their bindings filled
+// in from it when they are loaded. For any other library, importing only
+// records the name; the symbol is looked up on the first call and the
+// binding patched with it, so startup costs what a script calls rather
+// than what it imports. Bindings are shared by every import of the same
+// name and outlive the library, which can be closed and opened again.
+class NativeBinding final {
+   private:
+    std::string library;
+    std::string name;
+    std::atomic<NativeFunction> function;
+    std::atomic<int32_t> arity;
+    std::atomic<uint32_t> flags;
+
+    static std::unordered_map<std::string, std::unique_ptr<NativeBinding>>
+        bindings;
+    static std::unordered_map<std::string, std::string> paths;
+    static std::mutex mutex;
+
+    NativeFunction bind(const std::shared_ptr<Token>& address);
+    [[noreturn]] static void unbound(const std::shared_ptr<Token>& address,
+                                     const std::string& message);
+    [[noreturn]] void mismatch(std::shared_ptr<Token> address,
+                               size_t count) const;
+
+    static NativeBinding* find(const std::string& library,
+                               const std::string& name);
+
+   public:
+    NativeBinding(std::string _library, std::string _name);
+
+    // Given the call site, a failed first lookup is thrown to the script
+    // like any other error of the call.
+    NativeFunction resolve(const std::shared_ptr<Token>& address = nullptr) {
+        NativeFunction bound = this->function.load(std::memory_order_acquire);
+        return bound != nullptr ? bound : this->bind(address);
+    }
+
+    void expect(const std::shared_ptr<Token>& address, size_t count) const {
+        int32_t expected = this->arity.load(std::memory_order_relaxed);
+        if(expected >= 0 && count != static_cast<size_t>(expected))
+            this->mismatch(address, count);
+    }
+
+    const std::string& getName() const;
+    int32_t getArity() const;
+    bool isPure() const;
+    bool isThreadSafe() const;
+
+    static std::string locate(const std::string& libraryName);
+    static NativeBinding* get(const std::string& library,
+                              const std::string& name);
+    static bool link(const std::string& library, void* handle);
+    static void unbindAll();
+};
+
+#endif
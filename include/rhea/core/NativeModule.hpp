@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_NATIVE_MODULE_HPP
+#define RHEA_CORE_NATIVE_MODULE_HPP
+
+#include <cstdint>
+#include <rhea/core/DynamicObject.hpp>
+
+// Registration table a native library returns from `rhea_module_init`.
+// The interpreter reads it once when the library is loaded instead of
+// looking up a symbol per imported function. Bump the version whenever the
+// layout of NativeEntry or NativeModule changes.
+#define RHEA_MODULE_VERSION 1
+#define RHEA_MODULE_INIT "rhea_module_init"
+
+// Calls may be folded or reordered: the result depends on the arguments
+// alone and the function has no side effects.
+#define RHEA_NATIVE_PURE 1u
+
+// Calls may run on several threads at once.
+#define RHEA_NATIVE_THREAD_SAFE 2u
+
+// A function under the name scripts import it by, such as "math.cos". An
+// arity of -1 leaves checking the arguments to the function itself.
+class NativeEntry final {
+   public:
+    const char* name;
+    NativeFunction function;
+    int32_t arity;
+    uint32_t flags;
+};
+
+class NativeModule final {
+   public:
+    uint32_t version;
+    uint32_t count;
+    const NativeEntry* entries;
+};
+
+using NativeModuleInit = const NativeModule* (*)();
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef RHEA_CORE_RECLAIMER_HPP
+#define RHEA_CORE_RECLAIMER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Epoch-based reclamation for lock-free readers. A reader pins the global
+// epoch with a Guard while it dereferences shared data; writers unlink
+// data and retire it, and it is only deleted once every thread that was
+// pinned at or before the retiring epoch has let go.
+class Reclaimer final {
+   public:
+    using Deleter = void (*)(void*);
+
+    class Guard final {
+       public:
+        Guard() {
+            if(Reclaimer::depth++ != 0) return;
+            if(Reclaimer::current == nullptr) Reclaimer::enroll();
+
+            Reclaimer::current->pinned.store(
+                Reclaimer::epoch.load(std::memory_order_acquire),
+                std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        ~Guard() {
+            if(--Reclaimer::depth == 0)
+                Reclaimer::current->pinned.store(0, std::memory_order_release);
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+   private:
+    struct Retired {
+        uint64_t epoch;
+        void* pointer;
+        Deleter deleter;
+    };
+
+    class Participant final {
+       public:
+        std::atomic<uint64_t> pinned;
+        std::vector<Retired> retired;
+        size_t threshold;
+
+        Participant() : pinned(0), retired(), threshold(64) {
+        }
+    };
+
+    class Registry;
+    class Departure;
+
+    static inline std::atomic<uint64_t> epoch = 1;
+    static inline thread_local size_t depth = 0;
+    static inline thread_local Participant* current = nullptr;
+
+    static Registry& registry();
+    static void enroll();
+    static void leave();
+
+   public:
+    static void retire(void* pointer, Deleter deleter);
+    static void collect();
+};
+
+#endif
@@ -20,14 +20,19 @@
 #define RHEA_CORE_RUNTIME_HPP
 
 #include <csignal>
+#include <exception>
 #include <mutex>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/RuntimeEngine.hpp>
+#include <rhea/optimizer/OptimizationLevel.hpp>
 #include <unordered_map>
+#include <vector>
 
 class Runtime final {
    private:
-    static bool testMode, unsafeMode;
-    static std::vector<std::string> fileHashes;
+    static bool testMode, unsafeMode, dumpTree;
+    static RuntimeEngine engine;
+    static OptimizationLevel optimizationLevel;
     static std::unordered_map<std::string, void*> nativeLibraries;
     static std::mutex runtimeMtx;
 
@@ -38,14 +43,27 @@ class Runtime final {
     static bool isUnsafeMode();
     static void setUnsafeMode(bool _unsafeMode);
 
+    static RuntimeEngine getEngine();
+    static void setEngine(RuntimeEngine _engine);
+
+    static OptimizationLevel getOptimizationLevel();
+    static void setOptimizationLevel(OptimizationLevel _optimizationLevel);
+
+    static bool isDumpTree();
+    static void setDumpTree(bool _dumpTree);
+
     static void addLoadedLibrary(std::string libName, void* handle);
     static void* getLoadedLibrary(std::string libName);
     static bool hasLoadedLibrary(std::string libName);
 
-    static void addFileHash(std::string hash);
-    static bool hasFileHash(std::string hash);
-
     static void cleanUp();
+    static void report(const std::exception_ptr& error);
+
+    static std::vector<std::shared_ptr<ASTNode>> optimize(
+        const std::vector<std::shared_ptr<ASTNode>>& statements);
+    static DynamicObject evaluate(
+        SymbolTable& symbols,
+        const std::vector<std::shared_ptr<ASTNode>>& statements);
 
 #if defined(__linux__) || defined(__APPLE__) || defined(__EMSCRIPTEN__)
 
@@ -58,6 +76,7 @@ class Runtime final {
 
     static int interpreter(SymbolTable& symbols,
                            std::vector<std::string> files);
+    static int compile(std::vector<std::string> files);
 
     static void showPrompt();
     static void repl();
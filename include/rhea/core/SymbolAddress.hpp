@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_SYMBOL_ADDRESS_HPP
+#define RHEA_SYMBOL_ADDRESS_HPP
+
+#include <cstdint>
+
+enum class SymbolScope : uint8_t { DYNAMIC, LOCAL, GLOBAL };
+
+struct SymbolAddress {
+    SymbolScope scope = SymbolScope::DYNAMIC;
+    uint32_t depth = 0;
+    uint32_t slot = 0;
+};
+
+#endif
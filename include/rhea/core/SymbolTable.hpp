@@ -19,67 +19,186 @@
 #ifndef RHEA_SYMBOL_TABLE_HPP
 #define RHEA_SYMBOL_TABLE_HPP
 
-#include <future>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <rhea/ast/ASTNode.hpp>
 #include <rhea/core/DynamicObject.hpp>
-#include <rhea/util/RandomUtil.hpp>
-#include <unordered_map>
+#include <rhea/core/LockTable.hpp>
+#include <rhea/core/SymbolAddress.hpp>
+#include <rhea/core/Task.hpp>
+#include <string>
 #include <vector>
 
-class SymbolTable final {
+using SymbolLayout = std::vector<std::string>;
+
+class SymbolTable final : public std::enable_shared_from_this<SymbolTable> {
    private:
-    std::shared_ptr<SymbolTable> parent;
-    std::string id;
-    std::unordered_map<std::string, DynamicObject> table;
-    std::vector<std::future<void>> tasks;
+    // Readers never take the mutex: a slot array points to chunks of slots,
+    // and every slot points to an immutable boxed value (null while
+    // undefined). Writers swap whole boxes, retiring the old ones through
+    // the Reclaimer.
+    //
+    // Copies share the slot array, its chunks and the global index by
+    // reference count. A writer first makes its slot array and the chunk
+    // it touches exclusive, so a copy costs O(1) and a write to a shared
+    // table costs one chunk.
+    static constexpr size_t chunkSize = 32;
+
+    class Chunk final {
+       public:
+        std::atomic<size_t> references;
+        std::atomic<const DynamicObject*> values[chunkSize];
+
+        Chunk() : references(1), values() {
+        }
+    };
+
+    class Slots final {
+       public:
+        std::atomic<size_t> references;
+        size_t size;
+        std::unique_ptr<std::atomic<Chunk*>[]> chunks;
+
+        explicit Slots(size_t _size)
+            : references(1),
+              size((_size + chunkSize - 1) / chunkSize * chunkSize),
+              chunks(new std::atomic<Chunk*>[this->size / chunkSize]()) {
+        }
+    };
+
+    // Global names only ever get added, so the index is an open addressing
+    // table of immutable entries that readers probe without locking. An
+    // index shared with a copy is cloned before it gets a new name.
+    class Index final {
+       public:
+        class Entry final {
+           public:
+            std::string name;
+            uint32_t slot;
+        };
+
+        class Buckets final {
+           public:
+            size_t mask;
+            std::unique_ptr<std::atomic<const Entry*>[]> entries;
 
+            explicit Buckets(size_t capacity)
+                : mask(capacity - 1),
+                  entries(new std::atomic<const Entry*>[capacity]()) {
+            }
+        };
+
+        std::atomic<size_t> references;
+        std::deque<Entry> names;
+        std::atomic<Buckets*> buckets;
+
+        Index();
+        Index(const Index& other);
+        ~Index();
+
+        Index& operator=(const Index&) = delete;
+
+        bool find(const std::string& name, uint32_t& slot) const;
+        uint32_t insert(const std::string& name);
+
+       private:
+        static void dropBuckets(void* buckets);
+        void place(Buckets& target, const Entry& entry);
+    };
+
+    std::shared_ptr<SymbolTable> parent;
+    SymbolTable* root;
+    uint64_t serial;
+    std::shared_ptr<const SymbolLayout> layout;
+    std::atomic<Index*> globals;
+    std::atomic<Slots*> storage;
+    std::vector<std::shared_ptr<Task>> tasks;
     mutable std::recursive_mutex mtx;
 
+    // Bumped whenever a global callable binding may have changed; call-site
+    // caches compare against it instead of re-resolving the callee.
+    static inline std::atomic<uint64_t> epoch = 0;
+
+    // Root tables get a serial that is never reused, so a cache entry taken
+    // against one root cannot match another that reuses its address. Frames
+    // and pooled tables keep 0.
+    static inline std::atomic<uint64_t> serials = 0;
+
+    static uint64_t nextSerial(const SymbolTable* table);
+    static void invalidate();
+    void invalidate(const DynamicObject& previous,
+                    const DynamicObject& next) const;
+
+    bool findSlot(const std::string& name, uint32_t& slot) const;
+    SymbolTable* findScope(const std::string& name, uint32_t& slot);
+    SymbolTable* scopeAt(uint32_t depth);
+    void awaitWritable(const std::shared_ptr<Token>& reference,
+                       const std::string& name, uint32_t slot);
+
+    static void dropChunk(void* chunk);
+    static void dropSlots(void* slots);
+    static void dropIndex(void* index);
+    static void join(const std::vector<std::shared_ptr<Task>>& pending);
+
+    const DynamicObject* find(uint32_t slot) const;
+    bool isDefined(uint32_t slot) const;
+    bool read(uint32_t slot, DynamicObject& value) const;
+    void write(uint32_t slot, DynamicObject value);
+    void erase(uint32_t slot);
+
+    Slots* ownSlots(size_t size);
+    Chunk* ownChunk(Slots* slots, size_t index);
+    void share(const SymbolTable& other);
+    void clear();
+
    public:
-    explicit SymbolTable(std::string _id,
-                         std::shared_ptr<SymbolTable> _parent = nullptr)
-        : parent(std::move(_parent)),
-          id(std::move(_id)),
-          table({}),
-          tasks(),
-          mtx() {
-    }
+    explicit SymbolTable(std::shared_ptr<SymbolTable> _parent = nullptr);
+    explicit SymbolTable(std::shared_ptr<const SymbolLayout> _layout,
+                         std::shared_ptr<SymbolTable> _parent);
+    SymbolTable(const SymbolTable& other);
+    ~SymbolTable();
+
+    SymbolTable& operator=(SymbolTable&& other) noexcept;
+    SymbolTable& operator=(const SymbolTable& other);
 
-    explicit SymbolTable(std::shared_ptr<SymbolTable> _parent = nullptr)
-        : parent(std::move(_parent)),
-          id(RheaUtil::uniqueKey()),
-          table({}),
-          tasks(),
-          mtx() {
+    void reset(std::shared_ptr<const SymbolLayout> _layout,
+               std::shared_ptr<SymbolTable> _parent);
+
+    static uint64_t getEpoch() {
+        return SymbolTable::epoch.load(std::memory_order_acquire);
     }
 
-    SymbolTable(const SymbolTable& other)
-        : parent(other.parent),
-          id(other.id),
-          table(other.table),
-          tasks(),
-          mtx() {
+    uint64_t getSerial() const {
+        return this->serial;
     }
 
-    SymbolTable& operator=(SymbolTable&& other) noexcept;
-    SymbolTable& operator=(const SymbolTable& other);
+    SymbolTable& getRoot();
+    std::shared_ptr<SymbolTable> getReference();
+    uint32_t intern(const std::string& name);
 
     DynamicObject getSymbol(std::shared_ptr<Token> reference,
                             const std::string& name);
+    DynamicObject getSymbol(const std::shared_ptr<Token>& reference,
+                            const SymbolAddress& address);
 
     void setSymbol(std::shared_ptr<Token> reference, DynamicObject value);
+    void setSymbol(const std::shared_ptr<Token>& reference,
+                   const SymbolAddress& address, DynamicObject value);
 
     void removeSymbol(std::string name);
     void removeSymbol(std::shared_ptr<Token> name);
     bool hasSymbol(const std::string& name);
+    bool findLocal(uint32_t slot, DynamicObject& value) const;
 
-    void addParallelism(std::future<void> par);
+    void addParallelism(std::shared_ptr<Task> par);
     void waitForTasks();
 
-    void lock(std::string name, SymbolTable& requestOrigin);
-    void unlock(std::string name, SymbolTable& requestOrigin);
+    LockTable::Guard lock(const std::shared_ptr<Token>& variable,
+                          LockMode mode);
 };
 
 #endif
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_TASK_HPP
+#define RHEA_CORE_TASK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <rhea/core/DynamicObject.hpp>
+
+class Task final {
+   private:
+    std::function<DynamicObject()> work;
+    std::atomic<bool> claimed;
+    std::atomic<bool> finished;
+    std::atomic<bool> observed;
+    DynamicObject value;
+    std::exception_ptr error;
+    std::mutex mtx;
+    std::condition_variable done;
+
+    static inline thread_local Task* current = nullptr;
+
+   public:
+    explicit Task(std::function<DynamicObject()> _work)
+        : work(std::move(_work)),
+          claimed(false),
+          finished(false),
+          observed(false),
+          value(),
+          error(nullptr),
+          mtx(),
+          done() {
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool run();
+    bool isFinished() const;
+    bool isObserved() const;
+
+    static bool isRunning();
+    static Task* getCurrent();
+
+    void waitFor(std::chrono::milliseconds timeout);
+    DynamicObject get();
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_CORE_TASK_SCHEDULER_HPP
+#define RHEA_CORE_TASK_SCHEDULER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <rhea/core/Task.hpp>
+#include <thread>
+#include <vector>
+
+// Runtime-wide work-stealing pool. Every worker owns a deque: it pushes
+// and pops its own tasks at the back, while idle workers and threads
+// waiting on a task steal from the front of the others.
+class TaskScheduler final {
+   private:
+    class Queue final {
+       public:
+        std::deque<std::shared_ptr<Task>> tasks;
+        std::mutex mtx;
+
+        Queue() : tasks(), mtx() {
+        }
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> next;
+    std::atomic<size_t> queued;
+    std::mutex mtx;
+    std::condition_variable available;
+    size_t blocked;
+    size_t spares;
+
+    static inline size_t threadCount = 0;
+    static inline thread_local size_t workerIndex =
+        std::numeric_limits<size_t>::max();
+    static inline thread_local bool pooled = false;
+
+    explicit TaskScheduler(size_t count);
+
+    void work(size_t index);
+    void cover();
+    std::shared_ptr<Task> acquire();
+
+    void block();
+    void unblock();
+
+   public:
+    // Marks the calling pool thread as parked outside the scheduler for
+    // its lifetime. A spare worker takes its place until it returns, so a
+    // task blocked on another task that is still queued cannot stall it.
+    class Blocking final {
+       private:
+        bool counted;
+
+       public:
+        Blocking();
+        ~Blocking();
+
+        Blocking(const Blocking&) = delete;
+        Blocking& operator=(const Blocking&) = delete;
+    };
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    static TaskScheduler& getInstance();
+    static size_t getThreadCount();
+    static void setThreadCount(size_t count);
+
+    std::shared_ptr<Task> submit(std::function<DynamicObject()> task);
+    bool runPending();
+    void wait(const std::shared_ptr<Task>& task);
+};
+
+#endif
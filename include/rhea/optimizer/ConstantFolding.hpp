@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_OPTIMIZER_CONSTANT_FOLDING_HPP
+#define RHEA_OPTIMIZER_CONSTANT_FOLDING_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/optimizer/OptimizerPass.hpp>
+
+// Evaluates operators whose operands are all literals at compile time.
+// Operations that would fail are left in place so they still fail at run
+// time, at the same location.
+class ConstantFolding final : public OptimizerPass {
+   public:
+    std::shared_ptr<ASTNode> rewrite(
+        const std::shared_ptr<ASTNode>& node) override;
+};
+
+#endif
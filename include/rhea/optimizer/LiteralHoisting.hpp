@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_OPTIMIZER_LITERAL_HOISTING_HPP
+#define RHEA_OPTIMIZER_LITERAL_HOISTING_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/optimizer/OptimizerPass.hpp>
+#include <string>
+#include <unordered_map>
+
+// Builds string and regex literal values once and shares them between every
+// literal with the same text, instead of copying the string or recompiling
+// the pattern on each evaluation.
+class LiteralHoisting final : public OptimizerPass {
+   private:
+    std::unordered_map<std::string, DynamicObject> strings;
+    std::unordered_map<std::string, DynamicObject> regexes;
+
+   public:
+    LiteralHoisting() : strings({}), regexes({}) {
+    }
+
+    std::shared_ptr<ASTNode> rewrite(
+        const std::shared_ptr<ASTNode>& node) override;
+};
+
+#endif
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_OPTIMIZER_HPP
+#define RHEA_OPTIMIZER_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/optimizer/OptimizationLevel.hpp>
+#include <rhea/optimizer/OptimizerPass.hpp>
+#include <string>
+#include <vector>
+
+class Optimizer final {
+   private:
+    std::vector<std::unique_ptr<OptimizerPass>> passes;
+
+    static void run(OptimizerPass& pass, std::shared_ptr<ASTNode>& node);
+    static void dumpNode(const std::shared_ptr<ASTNode>& node, size_t depth,
+                         std::string& output);
+
+   public:
+    explicit Optimizer(OptimizationLevel level);
+
+    void addPass(std::unique_ptr<OptimizerPass> pass);
+    std::vector<std::shared_ptr<ASTNode>> optimize(
+        const std::vector<std::shared_ptr<ASTNode>>& statements);
+
+    static std::string dump(
+        const std::vector<std::shared_ptr<ASTNode>>& statements);
+};
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_OPTIMIZER_PASS_HPP
+#define RHEA_OPTIMIZER_PASS_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/parser/Token.hpp>
+
+class OptimizerPass {
+   protected:
+    static bool isConstant(const std::shared_ptr<ASTNode>& node,
+                           DynamicObject& value);
+    static std::shared_ptr<ASTNode> makeConstant(
+        std::shared_ptr<Token> address, const DynamicObject& value);
+
+   public:
+    virtual ~OptimizerPass() = default;
+
+    // Called bottom-up on every node, after its children have been
+    // rewritten; returns the node that should take its place.
+    virtual std::shared_ptr<ASTNode> rewrite(
+        const std::shared_ptr<ASTNode>& node) = 0;
+};
+
+#endif
@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
+#include <rhea/ast/expression/ParallelLoopExpression.hpp>
 #include <rhea/core/SymbolTable.hpp>
 #include <rhea/parser/Token.hpp>
 #include <rhea/parser/TokenCategory.hpp>
@@ -60,6 +61,9 @@ class Parser final {
     std::shared_ptr<ASTNode> exprTerm();
     std::shared_ptr<ASTNode> exprFactor();
     std::shared_ptr<ASTNode> exprParallel();
+    std::shared_ptr<ASTNode> exprParallelLoop(const Token& address);
+    ParallelReduction reduction();
+    std::shared_ptr<ASTNode> exprAwait();
     std::shared_ptr<ASTNode> exprVal();
     std::shared_ptr<ASTNode> exprSize();
     std::shared_ptr<ASTNode> exprLock();
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_SYMBOL_RESOLVER_HPP
+#define RHEA_SYMBOL_RESOLVER_HPP
+
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/SymbolAddress.hpp>
+#include <rhea/core/SymbolTable.hpp>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+class SymbolResolver final {
+   private:
+    class Scope final {
+       public:
+        std::shared_ptr<SymbolLayout> layout;
+        bool function;
+        bool capturing;
+    };
+
+    SymbolTable& symbols;
+    bool dynamic;
+    std::unordered_set<std::string> globals;
+    std::vector<Scope> scopes;
+
+    SymbolResolver(SymbolTable& _symbols, bool _dynamic)
+        : symbols(_symbols), dynamic(_dynamic), globals({}), scopes({}) {
+    }
+
+    static void collect(const std::shared_ptr<ASTNode>& node,
+                        std::vector<std::string>& assigned,
+                        std::vector<std::string>& declared);
+    static void markTailCalls(const std::shared_ptr<ASTNode>& node);
+
+    bool isKnown(const std::string& name);
+    SymbolAddress lookup(const std::string& name);
+    void declare(SymbolLayout& layout, const std::shared_ptr<ASTNode>& body);
+
+    void resolveNode(const std::shared_ptr<ASTNode>& node);
+    void resolveFunction(ASTNode* node);
+    void resolveCatchHandle(ASTNode* node);
+    void resolveParallelLoop(ASTNode* node);
+
+   public:
+    static void resolve(const std::vector<std::shared_ptr<ASTNode>>& statements,
+                        SymbolTable& symbols, bool dynamic = false);
+};
+
+#endif
@@ -54,6 +54,7 @@ class ArgumentParser final {
 
     void printAllParamWithDesc() const;
     bool hasParameter(const std::string& paramShort) const;
+    std::string getParameterValue(const std::string& paramShort) const;
 
     std::string getProgramFileName() const;
     std::vector<std::string> getInputFiles() const;
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef RHEA_UTIL_PARALLEL_FOR_HPP
+#define RHEA_UTIL_PARALLEL_FOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <rhea/core/Task.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace RheaUtil {
+
+// Element-wise loop over [0, count) that only starts an OpenMP team when
+// the measured cost of the work outweighs the calibrated cost of the team.
+// Loops already inside a team or a `parallel` task always run serially.
+class ParallelFor final {
+   public:
+    class Site final {
+       public:
+        const char* name;
+        size_t grain;
+        size_t minimumTrips;
+        std::atomic<double> itemCost;
+
+#ifdef RHEA_DEBUG
+        std::atomic<size_t> serialRuns;
+        std::atomic<size_t> parallelRuns;
+        std::atomic<size_t> iterations;
+#endif
+
+        explicit Site(const char* _name, size_t _grain = 1024,
+                      size_t _minimumTrips = 4096);
+
+        Site(const Site&) = delete;
+        Site& operator=(const Site&) = delete;
+    };
+
+   private:
+    static bool shouldSplit(Site& site, size_t count);
+    static void record(Site& site, size_t count, size_t threads,
+                       std::chrono::steady_clock::duration elapsed);
+
+   public:
+    static double getTeamCost();
+
+    template <typename Body>
+    static void run(Site& site, size_t count, Body&& body) {
+        if(count < site.minimumTrips) {
+            for(size_t i = 0; i < count; ++i) body(i);
+            return;
+        }
+
+        bool parallel = ParallelFor::shouldSplit(site, count);
+        size_t threads = 1;
+        auto start = std::chrono::steady_clock::now();
+
+#ifdef _OPENMP
+        if(parallel) {
+            threads = std::min(count / site.grain,
+                               static_cast<size_t>(omp_get_max_threads()));
+            long total = static_cast<long>(count);
+
+#pragma omp parallel for num_threads(static_cast<int>(threads)) \
+    schedule(static)
+            for(long i = 0; i < total; ++i) body(static_cast<size_t>(i));
+        } else
+#endif
+            for(size_t i = 0; i < count; ++i) body(i);
+
+        ParallelFor::record(site, count, threads,
+                            std::chrono::steady_clock::now() - start);
+    }
+
+    static void report();
+};
+
+};  // namespace RheaUtil
+
+#endif
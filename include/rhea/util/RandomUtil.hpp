@@ -46,30 +46,26 @@ inline static bool randomBoolValue() {
 }
 
 inline static std::string uniqueKey() {
-    const std::string characters =
+    static const char characters[] =
         "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
         "abcdefghijklmnopqrstuvwxyz"
         "0123456789";
-    std::string randomString;
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<uint32_t> dis(
-        static_cast<uint32_t>(0), static_cast<uint32_t>(characters.size() - 1));
-
-#if defined(__RDRND__) && defined(__RDSEED__)
-    uint32_t rand, seed, genSeed;
+    // Seeded once per thread: reseeding on every call cost more than
+    // whatever the key ends up naming.
+    thread_local std::mt19937_64 gen([]() {
+        std::random_device rd;
+        std::seed_seq seed{rd(), rd(), rd(), rd()};
 
-    while(_rdrand32_step(&rand) == 0);
-    while(_rdseed32_step(&seed) == 0);
-    while(_rdrand32_step(&genSeed) == 0);
-
-    gen.seed(genSeed);
-#endif
+        return std::mt19937_64(seed);
+    }());
+    std::uniform_int_distribution<uint32_t> dis(
+        static_cast<uint32_t>(0),
+        static_cast<uint32_t>(sizeof(characters) - 2));
 
-#pragma omp parallel for
-    for(size_t i = 0; i < 8; ++i)
-        randomString += characters[static_cast<uint32_t>(dis(gen))];
+    std::string randomString(8, ' ');
+    for(char& character : randomString)
+        character = characters[dis(gen)];
 
     return randomString;
 }
@@ -24,9 +24,13 @@
 
 namespace RheaUtil {
 
-inline static std::string replaceEscapeSequences(const std::string& input) {
+// A backslash or quote after a backslash is consumed as a pair, so the
+// `r` of `\\r` is never read as a carriage return. Regular expressions
+// keep both pairs as written for the regex engine to handle.
+inline static std::string replaceEscapeSequences(const std::string& input,
+                                                 bool regex = false) {
     std::string::const_iterator searchStart(input.cbegin());
-    std::regex escapeRegex(R"(\\(n|r|t|a|b|v|f|e))");
+    std::regex escapeRegex(R"(\\(n|r|t|a|b|v|f|e|\\|"))");
     std::string result;
     std::smatch match;
 
@@ -49,6 +53,10 @@ inline static std::string replaceEscapeSequences(const std::string& input) {
             result.append("\f");
         else if(match[1] == "e")
             result.append("\u001b");
+        else if(regex)
+            result.append(match[0].first, match[0].second);
+        else
+            result.append(match[1].first, match[1].second);
 
         searchStart = match[0].second;
     }
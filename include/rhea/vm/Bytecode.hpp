@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_VM_BYTECODE_HPP
+#define RHEA_VM_BYTECODE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/SymbolAddress.hpp>
+#include <rhea/core/SymbolTable.hpp>
+#include <rhea/parser/Token.hpp>
+#include <rhea/vm/Opcode.hpp>
+#include <vector>
+
+struct Instruction {
+    Opcode opcode;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+enum class HandlerType { LOOP, BLOCK };
+
+struct Handler {
+    HandlerType type;
+    uint32_t start;
+    uint32_t end;
+    uint32_t target;
+    uint32_t continueTarget;
+    uint32_t reg;
+};
+
+class Bytecode final {
+   private:
+    std::vector<Instruction> instructions;
+    std::vector<std::shared_ptr<Token>> addresses;
+    std::vector<DynamicObject> constants;
+    std::vector<std::shared_ptr<Token>> names;
+    std::vector<SymbolAddress> symbolAddresses;
+    std::vector<std::shared_ptr<ASTNode>> nodes;
+    std::vector<Handler> handlers;
+    std::shared_ptr<const SymbolLayout> locals;
+    uint32_t registerCount;
+
+   public:
+    Bytecode()
+        : instructions({}),
+          addresses({}),
+          constants({}),
+          names({}),
+          symbolAddresses({}),
+          nodes({}),
+          handlers({}),
+          locals(nullptr),
+          registerCount(0) {
+    }
+
+    uint32_t emit(std::shared_ptr<Token> address, Opcode opcode, uint32_t a,
+                  uint32_t b = 0, uint32_t c = 0);
+    void patch(uint32_t index, uint32_t target);
+    uint32_t position() const;
+
+    uint32_t addConstant(DynamicObject value);
+    uint32_t addName(const Token& name, SymbolAddress address = {});
+    uint32_t addNode(std::shared_ptr<ASTNode> node);
+    void addHandler(Handler handler);
+
+    void reserveRegisters(uint32_t count);
+    void setLocals(std::shared_ptr<const SymbolLayout> layout);
+
+    const std::vector<Instruction>& getInstructions() const {
+        return this->instructions;
+    }
+
+    const std::shared_ptr<Token>& getAddress(size_t index) const {
+        return this->addresses[index];
+    }
+
+    const DynamicObject& getConstant(uint32_t index) const {
+        return this->constants[index];
+    }
+
+    const std::shared_ptr<Token>& getName(uint32_t index) const {
+        return this->names[index];
+    }
+
+    const SymbolAddress& getSymbolAddress(uint32_t index) const {
+        return this->symbolAddresses[index];
+    }
+
+    const std::shared_ptr<ASTNode>& getNode(uint32_t index) const {
+        return this->nodes[index];
+    }
+
+    const std::vector<Handler>& getHandlers() const {
+        return this->handlers;
+    }
+
+    // Set when the function's locals live in registers 0..n-1 instead of a
+    // call frame; the arguments are passed in the leading registers.
+    const std::shared_ptr<const SymbolLayout>& getLocals() const {
+        return this->locals;
+    }
+
+    uint32_t getRegisterCount() const {
+        return this->registerCount;
+    }
+};
+
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_VM_BYTECODE_COMPILER_HPP
+#define RHEA_VM_BYTECODE_COMPILER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <rhea/ast/ASTNode.hpp>
+#include <rhea/vm/Bytecode.hpp>
+#include <vector>
+
+class BytecodeCompiler final {
+   private:
+    class LoopContext final {
+       public:
+        uint32_t continueTarget;
+        std::vector<uint32_t> breakJumps;
+        std::vector<uint32_t> continueJumps;
+    };
+
+    class BlockContext final {
+       public:
+        uint32_t reg;
+        std::vector<uint32_t> returnJumps;
+    };
+
+    std::shared_ptr<Bytecode> bytecode;
+    std::vector<LoopContext> loops;
+    std::vector<BlockContext> blocks;
+    uint32_t top;
+    uint32_t locals;
+    uint32_t parameters;
+    bool framed;
+
+    BytecodeCompiler()
+        : bytecode(std::make_shared<Bytecode>()),
+          loops({}),
+          blocks({}),
+          top(0),
+          locals(0),
+          parameters(0),
+          framed(false) {
+    }
+
+    bool isRegister(const SymbolAddress& address) const;
+
+    uint32_t allocate(uint32_t count = 1);
+    void release(uint32_t mark);
+
+    void compileNode(const std::shared_ptr<ASTNode>& node, uint32_t target);
+    void compileFallback(const std::shared_ptr<ASTNode>& node, uint32_t target);
+
+    void compileBinary(ASTNode* node, uint32_t target);
+    void compileAssignment(ASTNode* node, uint32_t target);
+    void compileArrayAssignment(ASTNode* node, uint32_t target);
+    void compileUnary(ASTNode* node, uint32_t target);
+    void compileBlock(ASTNode* node, uint32_t target);
+    void compileConditional(const std::shared_ptr<Token>& address,
+                            const std::shared_ptr<ASTNode>& condition,
+                            const std::shared_ptr<ASTNode>& thenBranch,
+                            const std::shared_ptr<ASTNode>& elseBranch,
+                            bool negate, uint32_t target);
+    void compileLoop(const std::shared_ptr<Token>& address,
+                     const std::shared_ptr<ASTNode>& initial,
+                     const std::shared_ptr<ASTNode>& condition,
+                     const std::shared_ptr<ASTNode>& postexpr,
+                     const std::shared_ptr<ASTNode>& body, uint32_t target);
+    void compileWhen(ASTNode* node, uint32_t target);
+    void compileCall(ASTNode* node, uint32_t target);
+    void compileFunction(ASTNode* node, uint32_t target);
+    void compileDeclaration(const std::shared_ptr<ASTNode>& node,
+                            uint32_t target);
+
+   public:
+    static std::shared_ptr<Bytecode> compile(
+        const std::vector<std::shared_ptr<ASTNode>>& statements);
+    static std::shared_ptr<Bytecode> compile(
+        const std::shared_ptr<ASTNode>& body);
+    static std::shared_ptr<Bytecode> compile(
+        const std::shared_ptr<ASTNode>& body,
+        std::shared_ptr<const SymbolLayout> layout, uint32_t parameters);
+};
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_VM_OPCODE_HPP
+#define RHEA_VM_OPCODE_HPP
+
+#include <cstdint>
+
+// Operand layout is documented per opcode as A, B, C; R[x] is a register,
+// L[x] a function local kept in register x, K[x] a constant, N[x] a symbol
+// name with its resolved address, O[x] an operator enumerator and X[x] an
+// AST node evaluated by the tree-walking fallback.
+#define RHEA_VM_OPCODES(OPCODE)                                      \
+    OPCODE(NOP)             /* -                                  */ \
+    OPCODE(LOAD_NIL)        /* R[A] = nil                         */ \
+    OPCODE(LOAD_BOOL)       /* R[A] = (bool) B                    */ \
+    OPCODE(LOAD_CONST)      /* R[A] = K[B]                        */ \
+    OPCODE(CLOSURE)         /* R[A] = K[B] bound to symbols       */ \
+    OPCODE(MOVE)            /* R[A] = R[B]                        */ \
+    OPCODE(GET_SYMBOL)      /* R[A] = symbols[N[B]]               */ \
+    OPCODE(SET_SYMBOL)      /* symbols[N[B]] = R[A]               */ \
+    OPCODE(GET_LOCAL)       /* R[A] = L[B], N[C] if unbound       */ \
+    OPCODE(SET_LOCAL)       /* L[B] = R[A]                        */ \
+    OPCODE(NEW_ARRAY)       /* R[A] = [R[B], ..., R[B + C - 1]]   */ \
+    OPCODE(GET_INDEX)       /* R[A] = R[B][R[C]]                  */ \
+    OPCODE(SET_INDEX)       /* R[A][R[B]] = R[C]                  */ \
+    OPCODE(ADD)             /* R[A] = R[B] + R[C]                 */ \
+    OPCODE(SUB)             /* R[A] = R[B] - R[C]                 */ \
+    OPCODE(MUL)             /* R[A] = R[B] * R[C]                 */ \
+    OPCODE(DIV)             /* R[A] = R[B] / R[C]                 */ \
+    OPCODE(RDIV)            /* R[A] = R[C] / R[B]                 */ \
+    OPCODE(MOD)             /* R[A] = R[B] % R[C]                 */ \
+    OPCODE(BIT_AND)         /* R[A] = R[B] & R[C]                 */ \
+    OPCODE(BIT_OR)          /* R[A] = R[B] | R[C]                 */ \
+    OPCODE(BIT_XOR)         /* R[A] = R[B] ^ R[C]                 */ \
+    OPCODE(SHIFT_LEFT)      /* R[A] = R[B] << R[C]                */ \
+    OPCODE(SHIFT_RIGHT)     /* R[A] = R[B] >> R[C]                */ \
+    OPCODE(LOGIC_AND)       /* R[A] = R[B] && R[C]                */ \
+    OPCODE(LOGIC_OR)        /* R[A] = R[B] || R[C]                */ \
+    OPCODE(EQUAL)           /* R[A] = R[B] == R[C]                */ \
+    OPCODE(NOT_EQUAL)       /* R[A] = R[B] != R[C]                */ \
+    OPCODE(LESS)            /* R[A] = R[B] < R[C]                 */ \
+    OPCODE(GREATER)         /* R[A] = R[B] > R[C]                 */ \
+    OPCODE(LESS_EQUAL)      /* R[A] = R[B] <= R[C]                */ \
+    OPCODE(GREATER_EQUAL)   /* R[A] = R[B] >= R[C]                */ \
+    OPCODE(BINARY)          /* R[A] = R[A] O[C] R[B]              */ \
+    OPCODE(NOT)             /* R[A] = !R[B]                       */ \
+    OPCODE(NEGATE)          /* R[A] = -R[B]                       */ \
+    OPCODE(UNARY)           /* R[A] = O[C] R[B]                   */ \
+    OPCODE(JUMP)            /* goto B                             */ \
+    OPCODE(JUMP_IF_FALSE)   /* if(!R[A]) goto B                   */ \
+    OPCODE(JUMP_IF_TRUE)    /* if(R[A]) goto B                    */ \
+    OPCODE(JUMP_IF_NOT_NIL) /* if(R[A] != nil) goto B             */ \
+    OPCODE(CALL)            /* R[A] = R[B](R[B + 1], ..., R[B+C]) */ \
+    OPCODE(TAIL_CALL)       /* CALL, function run by the caller   */ \
+    OPCODE(RENDER)          /* render R[A], B = newline | stderr  */ \
+    OPCODE(EVAL)            /* R[A] = X[B]->visit(symbols)        */ \
+    OPCODE(SIGNAL_BREAK)    /* complete abruptly with break       */ \
+    OPCODE(SIGNAL_CONTINUE) /* complete abruptly with continue    */ \
+    OPCODE(SIGNAL_RETURN)   /* complete abruptly with ret R[A]    */ \
+    OPCODE(RETURN)          /* return R[A]                        */
+
+enum class Opcode : uint8_t {
+#define RHEA_VM_OPCODE_ENUM(name) name,
+    RHEA_VM_OPCODES(RHEA_VM_OPCODE_ENUM)
+#undef RHEA_VM_OPCODE_ENUM
+};
+
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_VM_VIRTUAL_MACHINE_HPP
+#define RHEA_VM_VIRTUAL_MACHINE_HPP
+
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/SymbolTable.hpp>
+#include <rhea/vm/Bytecode.hpp>
+#include <vector>
+
+class VirtualMachine final {
+   private:
+    class RegisterFile final {
+       private:
+        std::vector<DynamicObject> registers;
+        std::vector<uint8_t> bound;
+
+        static thread_local std::vector<std::vector<DynamicObject>> pool;
+        static thread_local std::vector<std::vector<uint8_t>> boundPool;
+
+       public:
+        explicit RegisterFile(uint32_t count, uint32_t locals);
+        ~RegisterFile();
+
+        RegisterFile(const RegisterFile&) = delete;
+        RegisterFile& operator=(const RegisterFile&) = delete;
+
+        DynamicObject* data();
+        uint8_t* flags();
+
+        void store(SymbolTable& frame);
+        void load(const SymbolTable& frame);
+    };
+
+    static const Handler* findHandler(const Bytecode& bytecode,
+                                      HandlerType type, uint32_t position);
+    static bool resume(const Bytecode& bytecode, uint32_t position,
+                       DynamicObject* reg, uint32_t& target);
+
+   public:
+    static DynamicObject execute(
+        const Bytecode& bytecode, SymbolTable& symbols,
+        const std::vector<DynamicObject>& arguments = {});
+};
+
+#endif
@@ -17,7 +17,13 @@
  */
 
 #include <Rhea.hpp>
+#include <algorithm>
+#include <cctype>
 #include <iostream>
+#include <rhea/ast/Specialization.hpp>
+#include <rhea/core/LockTable.hpp>
+#include <rhea/core/TaskScheduler.hpp>
+#include <rhea/util/ParallelFor.hpp>
 #include <rhea/util/Render.hpp>
 #include <stdexcept>
 
@@ -109,6 +115,30 @@ auto main(int argc, char** argv) -> int {
     argParse.defineParameter("t", "test", "Run the script files in test mode.");
     argParse.defineParameter("u", "unsafe",
                              "Run the script files in unsafe mode.");
+    argParse.defineParameter("e", "engine",
+                             "Execution engine to use: vm (default) or ast.");
+    argParse.defineParameter(
+        "s", "specialization-stats",
+        "Print AST node specialization and call-site cache counters after "
+        "execution.");
+    argParse.defineParameter("l", "lock-stats",
+                             "Print lock contention counters after execution.");
+    argParse.defineParameter("O0", "opt-none",
+                             "Run the syntax tree without optimization.");
+    argParse.defineParameter(
+        "O1", "opt-basic",
+        "Fold constants and drop dead branches (default).");
+    argParse.defineParameter(
+        "O2", "opt-full",
+        "Also hoist string and regular expression literals.");
+    argParse.defineParameter(
+        "j", "threads",
+        "Number of worker threads for parallel tasks (default: CPU count).");
+    argParse.defineParameter("d", "dump-ast",
+                             "Print the optimized syntax tree before running.");
+    argParse.defineParameter(
+        "c", "compile",
+        "Write token caches (.rheac) for the given files and directories.");
 
     if(argParse.hasParameter("h")) {
         printBanner(argParse);
@@ -119,12 +149,63 @@ auto main(int argc, char** argv) -> int {
 
     if(argParse.hasParameter("u")) Runtime::setUnsafeMode(true);
 
+    if(argParse.hasParameter("s")) Specialization::setProfiling(true);
+
+    if(argParse.hasParameter("d")) Runtime::setDumpTree(true);
+
+    if(argParse.hasParameter("O0"))
+        Runtime::setOptimizationLevel(OptimizationLevel::O0);
+    else if(argParse.hasParameter("O2"))
+        Runtime::setOptimizationLevel(OptimizationLevel::O2);
+    else if(argParse.hasParameter("O1"))
+        Runtime::setOptimizationLevel(OptimizationLevel::O1);
+
+    std::string engine = argParse.getParameterValue("e");
+    if(engine == "ast")
+        Runtime::setEngine(RuntimeEngine::AST);
+    else if(engine == "vm")
+        Runtime::setEngine(RuntimeEngine::VM);
+    else if(!engine.empty()) {
+        RheaUtil::renderError("Unknown execution engine: " + engine + "\r\n");
+        return 1;
+    }
+
+    std::string threads = argParse.getParameterValue("j");
+    if(!threads.empty()) {
+        // std::stoul alone would take "8abc" as 8 and wrap "-1" around.
+        size_t count = 0;
+        bool digits = std::all_of(threads.begin(), threads.end(),
+                                  [](unsigned char ch) {
+                                      return std::isdigit(ch) != 0;
+                                  });
+
+        try {
+            if(digits) count = std::stoul(threads);
+        } catch(const std::exception&) {
+            count = 0;
+        }
+
+        if(count == 0) {
+            RheaUtil::renderError("Invalid thread count: " + threads + "\r\n");
+            return 1;
+        }
+
+        TaskScheduler::setThreadCount(count);
+    }
+
     if(argParse.hasParameter("r")) {
         Runtime::repl();
         return 0;
-    } else if(argc > 1) {
+    } else if(argParse.hasParameter("c"))
+        return Runtime::compile(argParse.getInputFiles());
+    else if(argc > 1) {
         SymbolTable symbols;
-        return Runtime::interpreter(symbols, argParse.getInputFiles());
+        int status = Runtime::interpreter(symbols, argParse.getInputFiles());
+
+        if(Specialization::isProfiling()) Specialization::report();
+        if(argParse.hasParameter("l")) LockTable::report();
+        RheaUtil::ParallelFor::report();
+        return status;
     }
 
     printBanner(argParse);
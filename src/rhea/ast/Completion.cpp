@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/Completion.hpp>
+#include <rhea/ast/TerminativeSignal.hpp>
+
+thread_local std::shared_ptr<Token> Completion::origin = nullptr;
+
+void Completion::signal(CompletionType kind,
+                        const std::shared_ptr<Token>& address) {
+    Completion::type = kind;
+    if(kind != CompletionType::RETURN) Completion::origin = address;
+}
+
+void Completion::raise(const DynamicObject& value) {
+    CompletionType kind = Completion::type;
+    Completion::type = CompletionType::NORMAL;
+
+    switch(kind) {
+        case CompletionType::BREAK:
+            throw TerminativeBreakSignal(*Completion::origin);
+
+        case CompletionType::CONTINUE:
+            throw TerminativeContinueSignal(*Completion::origin);
+
+        case CompletionType::RETURN:
+            throw TerminativeReturnSignal(value);
+
+        case CompletionType::NORMAL:
+        default:
+            break;
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/InlineCache.hpp>
+#include <rhea/ast/Specialization.hpp>
+
+bool InlineCache::lookup(const SymbolTable& symbols, DynamicObject& result) {
+    std::unique_lock<std::mutex> lock(this->mtx, std::try_to_lock);
+    if(!lock.owns_lock() || this->root == 0 ||
+       this->root != symbols.getSerial() ||
+       this->epoch != SymbolTable::getEpoch()) {
+        Specialization::miss(SpecializedNode::CALL_SITE);
+        return false;
+    }
+
+    result = this->target;
+    Specialization::hit(SpecializedNode::CALL_SITE);
+    return true;
+}
+
+void InlineCache::update(const SymbolTable& symbols, uint64_t resolvedEpoch,
+                         const DynamicObject& value) {
+    std::unique_lock<std::mutex> lock(this->mtx, std::try_to_lock);
+    if(!lock.owns_lock()) return;
+
+    this->root = symbols.getSerial();
+    this->epoch = resolvedEpoch;
+    this->target = value;
+    Specialization::rewrite(SpecializedNode::CALL_SITE);
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/Specialization.hpp>
+#include <rhea/util/Render.hpp>
+#include <string>
+
+void Specialization::setProfiling(bool enabled) {
+    Specialization::profiling = enabled;
+}
+
+bool Specialization::isProfiling() {
+    return Specialization::profiling;
+}
+
+void Specialization::report() {
+    static const char* names[nodeCount] = {"NumberBinary", "StringBinary",
+                                           "NumberUnary", "ArrayIndexNumber",
+                                           "CallSite"};
+
+    std::string text;
+    for(size_t i = 0; i < nodeCount; i++)
+        text += std::string(names[i]) + ": " +
+                std::to_string(Specialization::rewrites[i].load()) +
+                " rewrites, " +
+                std::to_string(Specialization::hits[i].load()) + " hits, " +
+                std::to_string(Specialization::misses[i].load()) +
+                " misses\r\n";
+
+    RheaUtil::renderError(text);
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/TailCall.hpp>
+#include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+
+thread_local std::shared_ptr<FunctionDeclarationExpression> TailCall::callee =
+    nullptr;
+thread_local std::vector<DynamicObject> TailCall::arguments;
+
+void TailCall::schedule(std::shared_ptr<FunctionDeclarationExpression> function,
+                        std::vector<DynamicObject> args) {
+    TailCall::pending = true;
+    TailCall::callee = std::move(function);
+    TailCall::arguments = std::move(args);
+}
+
+std::shared_ptr<FunctionDeclarationExpression> TailCall::take(
+    std::vector<DynamicObject>& args) {
+    TailCall::pending = false;
+    args = std::move(TailCall::arguments);
+    TailCall::arguments.clear();
+
+    return std::move(TailCall::callee);
+}
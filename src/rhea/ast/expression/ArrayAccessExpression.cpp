@@ -21,37 +21,80 @@
 #include <rhea/ast/expression/ArrayAccessExpression.hpp>
 #include <rhea/parser/Token.hpp>
 
-ASTNode* ArrayAccessExpression::getArrayExpression() const {
-    return std::move(this->array.get());
+const std::shared_ptr<ASTNode>& ArrayAccessExpression::getArrayExpression()
+    const {
+    return this->array;
 }
 
-ASTNode* ArrayAccessExpression::getIndexExpression() const {
-    return std::move(this->index.get());
+const std::shared_ptr<ASTNode>& ArrayAccessExpression::getIndexExpression()
+    const {
+    return this->index;
 }
 
 DynamicObject ArrayAccessExpression::visit(SymbolTable& symbols) {
     DynamicObject origin = this->array->visit(symbols);
     if(!origin.isArray() && !origin.isString())
         throw ASTNodeException(
-            std::move(this->address),
+            this->address,
             "Accessing non-array and non-string object is invalid.");
 
     DynamicObject idx = this->index->visit(symbols);
+    switch(this->state.load(std::memory_order_relaxed)) {
+        case SpecializationState::NUMBER:
+            if(origin.isArray() && idx.isNumber()) {
+                auto elements = origin.getArray();
+                double rawIdx = idx.getNumber();
+
+                if(rawIdx >= 0 &&
+                   static_cast<size_t>(rawIdx) < elements->size()) {
+                    Specialization::hit(SpecializedNode::ARRAY_INDEX_NUMBER);
+                    return (*elements)[static_cast<size_t>(rawIdx)];
+                }
+                break;
+            }
+
+            this->state.store(SpecializationState::GENERIC,
+                              std::memory_order_relaxed);
+            Specialization::miss(SpecializedNode::ARRAY_INDEX_NUMBER);
+            break;
+
+        case SpecializationState::UNINITIALIZED:
+            if(origin.isArray() && idx.isNumber()) {
+                this->state.store(SpecializationState::NUMBER,
+                                  std::memory_order_relaxed);
+                Specialization::rewrite(SpecializedNode::ARRAY_INDEX_NUMBER);
+            } else
+                this->state.store(SpecializationState::GENERIC,
+                                  std::memory_order_relaxed);
+            break;
+
+        case SpecializationState::STRING:
+        case SpecializationState::GENERIC:
+        default:
+            break;
+    }
+
+    return ArrayAccessExpression::access(this->address, origin, idx);
+}
+
+DynamicObject ArrayAccessExpression::access(std::shared_ptr<Token> address,
+                                            DynamicObject origin,
+                                            DynamicObject idx) {
     if(origin.isString()) {
         if(!idx.isNumber())
             throw ASTNodeException(
-                std::move(this->address),
+                std::move(address),
                 "Accessing string with non-number index is not allowed.");
 
         double rawIdx = idx.getNumber();
         if(rawIdx < 0)
-            throw ASTNodeException(std::move(this->address),
+            throw ASTNodeException(std::move(address),
                                    "String index cannot be negative.");
 
         size_t i = static_cast<size_t>(rawIdx);
         const std::string& str = origin.getString();
         if(i >= str.size())
-            throw ASTNodeException(std::move(this->address),
+            throw ASTNodeException(std::move(address),
                                    "String index " + std::to_string(i) +
                                        " is out of bounds (size=" +
                                        std::to_string(str.size()) + ").");
@@ -60,25 +103,31 @@ DynamicObject ArrayAccessExpression::visit(SymbolTable& symbols) {
     } else if(origin.isArray()) {
         if(!idx.isNumber())
             throw ASTNodeException(
-                std::move(this->address),
+                std::move(address),
                 "Accessing array with non-number index is not allowed.");
 
         double rawIdx = idx.getNumber();
         if(rawIdx < 0)
-            throw ASTNodeException(std::move(this->address),
+            throw ASTNodeException(std::move(address),
                                    "Array index cannot be negative.");
 
         size_t i = static_cast<size_t>(rawIdx);
         auto arr = origin.getArray();
         if(i >= arr->size())
-            throw ASTNodeException(std::move(this->address),
+            throw ASTNodeException(std::move(address),
                                    "Array index " + std::to_string(i) +
                                        " is out of bounds (size=" +
                                        std::to_string(arr->size()) + ").");
 
-        return DynamicObject(std::move(arr->at(i)));
+        return arr->at(i);
     }
 
-    throw ASTNodeException(std::move(this->address),
-                           "Dynamic object is not of array type.");
+    throw ASTNodeException(
+        std::move(address),
+        "Accessing non-array and non-string object is invalid.");
+}
+
+void ArrayAccessExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->array);
+    callback(this->index);
 }
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/expression/ArrayAssignmentExpression.hpp>
+#include <string>
+
+const std::shared_ptr<ASTNode>& ArrayAssignmentExpression::getArrayExpression()
+    const {
+    return this->array;
+}
+
+const std::shared_ptr<ASTNode>& ArrayAssignmentExpression::getIndexExpression()
+    const {
+    return this->index;
+}
+
+const std::shared_ptr<ASTNode>& ArrayAssignmentExpression::getValue() const {
+    return this->value;
+}
+
+DynamicObject ArrayAssignmentExpression::visit(SymbolTable& symbols) {
+    DynamicObject arrayValue = this->array->visit(symbols);
+    if(!arrayValue.isArray())
+        throw ASTNodeException(this->address,
+                               "Object is not an array, cannot update "
+                               "value in specified index.");
+
+    DynamicObject indexValue = this->index->visit(symbols);
+    ArrayAssignmentExpression::assign(this->address, arrayValue, indexValue,
+                                      this->value->visit(symbols));
+
+    return arrayValue;
+}
+
+void ArrayAssignmentExpression::assign(const std::shared_ptr<Token>& address,
+                                       DynamicObject& array,
+                                       const DynamicObject& index,
+                                       const DynamicObject& value) {
+    if(!array.isArray())
+        throw ASTNodeException(address,
+                               "Object is not an array, cannot update "
+                               "value in specified index.");
+
+    if(!index.isNumber())
+        throw ASTNodeException(address, "Specified index is not a number.");
+
+    double rawIdx = index.getNumber();
+    if(rawIdx < 0)
+        throw ASTNodeException(address, "Array index cannot be negative.");
+
+    size_t idx = static_cast<size_t>(rawIdx);
+    if(idx >= array.getArray()->size())
+        throw ASTNodeException(
+            address, "Array index " + std::to_string(idx) +
+                         " is out of bounds (size=" +
+                         std::to_string(array.getArray()->size()) + ").");
+
+    array.setArrayElement(address, idx, std::make_shared<DynamicObject>(value));
+}
+
+void ArrayAssignmentExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->array);
+    callback(this->index);
+    callback(this->value);
+}
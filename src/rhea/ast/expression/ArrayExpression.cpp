@@ -19,6 +19,11 @@
 #include <memory>
 #include <rhea/ast/expression/ArrayExpression.hpp>
 
+const std::vector<std::shared_ptr<ASTNode>>& ArrayExpression::getElements()
+    const {
+    return this->elements;
+}
+
 DynamicObject ArrayExpression::visit(SymbolTable& symbols) {
     std::shared_ptr<std::vector<DynamicObject>> objects =
         std::make_shared<std::vector<DynamicObject>>();
@@ -28,3 +33,7 @@ DynamicObject ArrayExpression::visit(SymbolTable& symbols) {
 
     return DynamicObject(objects);
 }
+
+void ArrayExpression::forEachChild(const ASTChildCallback& callback) {
+    for(auto& child : this->elements) callback(child);
+}
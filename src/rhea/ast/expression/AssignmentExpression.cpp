@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/expression/AssignmentExpression.hpp>
+
+const std::shared_ptr<VariableAccessExpression>&
+AssignmentExpression::getVariable() const {
+    return this->variable;
+}
+
+const std::shared_ptr<ASTNode>& AssignmentExpression::getValue() const {
+    return this->value;
+}
+
+DynamicObject AssignmentExpression::visit(SymbolTable& symbols) {
+    DynamicObject result = this->value->visit(symbols);
+    symbols.setSymbol(this->variable->getNameToken(),
+                      this->variable->getSymbolAddress(), result);
+
+    return result;
+}
+
+void AssignmentExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->value);
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/expression/AwaitExpression.hpp>
+#include <rhea/core/Task.hpp>
+#include <rhea/core/TaskScheduler.hpp>
+
+const std::shared_ptr<ASTNode>& AwaitExpression::getExpression() const {
+    return this->expression;
+}
+
+DynamicObject AwaitExpression::visit(SymbolTable& symbols) {
+    DynamicObject value = this->expression->visit(symbols);
+    if(!value.isFuture())
+        throw ASTNodeException(this->address,
+                               "Expression is not a parallel task.");
+
+    std::shared_ptr<Task> task = value.getFuture();
+    if(!task->isFinished()) TaskScheduler::getInstance().wait(task);
+
+    return task->get();
+}
+
+void AwaitExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
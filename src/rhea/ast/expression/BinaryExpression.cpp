@@ -17,177 +17,439 @@
  */
 
 #include <Rhea.hpp>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <regex>
 #include <rhea/ast/ASTNodeException.hpp>
-#include <rhea/ast/expression/ArrayAccessExpression.hpp>
 #include <rhea/ast/expression/BinaryExpression.hpp>
-#include <rhea/ast/expression/VariableAccessExpression.hpp>
 #include <rhea/parser/Token.hpp>
 #include <rhea/util/VectorMath.hpp>
+#include <unordered_map>
+
+const std::shared_ptr<ASTNode>& BinaryExpression::getLeft() const {
+    return this->left;
+}
+
+BinaryOperator BinaryExpression::getOperator() const {
+    return this->op;
+}
+
+const std::shared_ptr<ASTNode>& BinaryExpression::getRight() const {
+    return this->right;
+}
 
 DynamicObject BinaryExpression::visit(SymbolTable& symbols) {
-    auto* arrayAccess = dynamic_cast<ArrayAccessExpression*>(this->left.get());
-    if(arrayAccess && this->op == "=") {
-        auto arrayExpr = arrayAccess->getArrayExpression();
-        auto arrayIdx = arrayAccess->getIndexExpression();
-
-        DynamicObject arrayVal = arrayExpr->visit(symbols);
-        if(!arrayVal.isArray())
-            throw ASTNodeException(std::move(this->address),
-                                   "Object is not an array, cannot update "
-                                   "value in specified index.");
-
-        DynamicObject indexVal = arrayIdx->visit(symbols);
-        if(!indexVal.isNumber())
-            throw ASTNodeException(std::move(this->address),
-                                   "Specified index is not a number.");
-
-        DynamicObject rValue = this->right->visit(symbols);
-        std::shared_ptr<DynamicObject> rValuePtr =
-            std::make_shared<DynamicObject>(rValue);
-
-        double rawIdx = indexVal.getNumber();
-        if(rawIdx < 0)
-            throw ASTNodeException(std::move(this->address),
-                                   "Array index cannot be negative.");
-
-        size_t idx = static_cast<size_t>(rawIdx);
-        if(idx >= arrayVal.getArray()->size())
-            throw ASTNodeException(
-                std::move(this->address),
-                "Array index " + std::to_string(idx) +
-                    " is out of bounds (size=" +
-                    std::to_string(arrayVal.getArray()->size()) + ").");
-
-        arrayVal.setArrayElement(std::move(this->address), idx,
-                                 std::move(rValuePtr));
-
-        return arrayVal;
+    DynamicObject lValue = this->left->visit(symbols);
+    DynamicObject rValue = this->right->visit(symbols);
+
+    // The handler is published before the state that selects it, so an
+    // acquiring load of the state always sees a handler to call.
+    switch(this->state.load(std::memory_order_acquire)) {
+        case SpecializationState::NUMBER:
+            if(lValue.isNumber() && rValue.isNumber()) {
+                Specialization::hit(SpecializedNode::NUMBER_BINARY);
+                return this->numberPath.load(std::memory_order_relaxed)(
+                    lValue.getNumber(), rValue.getNumber());
+            }
+
+            this->deoptimize(SpecializedNode::NUMBER_BINARY);
+            break;
+
+        case SpecializationState::STRING:
+            if(lValue.isString() && rValue.isString()) {
+                Specialization::hit(SpecializedNode::STRING_BINARY);
+                return this->stringPath.load(std::memory_order_relaxed)(
+                    lValue.getString(), rValue.getString());
+            }
+
+            this->deoptimize(SpecializedNode::STRING_BINARY);
+            break;
+
+        case SpecializationState::UNINITIALIZED:
+            this->specialize(lValue, rValue);
+            break;
+
+        case SpecializationState::GENERIC:
+        default:
+            break;
+    }
+
+    return BinaryExpression::applyOperator(this->address, this->op, lValue,
+                                           rValue);
+}
+
+void BinaryExpression::specialize(const DynamicObject& lValue,
+                                  const DynamicObject& rValue) {
+    NumberHandler number = BinaryExpression::numberHandler(this->op);
+    StringHandler string = BinaryExpression::stringHandler(this->op);
+
+    if(lValue.isNumber() && rValue.isNumber() && number != nullptr) {
+        this->numberPath.store(number, std::memory_order_relaxed);
+        this->state.store(SpecializationState::NUMBER,
+                          std::memory_order_release);
+        Specialization::rewrite(SpecializedNode::NUMBER_BINARY);
+    } else if(lValue.isString() && rValue.isString() && string != nullptr) {
+        this->stringPath.store(string, std::memory_order_relaxed);
+        this->state.store(SpecializationState::STRING,
+                          std::memory_order_release);
+        Specialization::rewrite(SpecializedNode::STRING_BINARY);
+    } else
+        this->state.store(SpecializationState::GENERIC,
+                          std::memory_order_relaxed);
+}
+
+void BinaryExpression::deoptimize(SpecializedNode node) {
+    this->state.store(SpecializationState::GENERIC, std::memory_order_relaxed);
+    Specialization::miss(node);
+}
+
+BinaryExpression::NumberHandler BinaryExpression::numberHandler(
+    BinaryOperator op) {
+    switch(op) {
+        case BinaryOperator::ADD:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs + rhs);
+            };
+
+        case BinaryOperator::SUB:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs - rhs);
+            };
+
+        case BinaryOperator::MUL:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs * rhs);
+            };
+
+        case BinaryOperator::LESS:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs < rhs);
+            };
+
+        case BinaryOperator::GREATER:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs > rhs);
+            };
+
+        case BinaryOperator::LESS_EQUAL:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs <= rhs);
+            };
+
+        case BinaryOperator::GREATER_EQUAL:
+            return [](double lhs, double rhs) {
+                return DynamicObject(lhs >= rhs);
+            };
+
+        case BinaryOperator::EQUAL:
+            return [](double lhs, double rhs) {
+                return DynamicObject(std::fabs(lhs - rhs) <
+                                     std::numeric_limits<double>::epsilon());
+            };
+
+        case BinaryOperator::NOT_EQUAL:
+            return [](double lhs, double rhs) {
+                return DynamicObject(std::fabs(lhs - rhs) >=
+                                     std::numeric_limits<double>::epsilon());
+            };
+
+        case BinaryOperator::ASSIGN:
+        case BinaryOperator::DIV:
+        case BinaryOperator::RDIV:
+        case BinaryOperator::MOD:
+        case BinaryOperator::BIT_AND:
+        case BinaryOperator::BIT_OR:
+        case BinaryOperator::BIT_XOR:
+        case BinaryOperator::SHIFT_LEFT:
+        case BinaryOperator::SHIFT_RIGHT:
+        case BinaryOperator::LOGIC_AND:
+        case BinaryOperator::LOGIC_OR:
+        case BinaryOperator::NIL_COALESCE:
+        case BinaryOperator::REGEX_MATCH:
+        case BinaryOperator::REGEX_NOT_MATCH:
+        case BinaryOperator::VECTOR_ADD:
+        case BinaryOperator::VECTOR_SUB:
+        case BinaryOperator::VECTOR_MUL:
+        case BinaryOperator::VECTOR_DIV:
+        case BinaryOperator::VECTOR_REM:
+        case BinaryOperator::VECTOR_BIT_AND:
+        case BinaryOperator::VECTOR_BIT_OR:
+        case BinaryOperator::VECTOR_BIT_XOR:
+        case BinaryOperator::VECTOR_SHIFT_LEFT:
+        case BinaryOperator::VECTOR_SHIFT_RIGHT:
+        default:
+            return nullptr;
     }
+}
+
+BinaryExpression::StringHandler BinaryExpression::stringHandler(
+    BinaryOperator op) {
+    switch(op) {
+        case BinaryOperator::ADD:
+            return [](const std::string& lhs, const std::string& rhs) {
+                return DynamicObject(lhs + rhs);
+            };
 
-    auto* varAccess = dynamic_cast<VariableAccessExpression*>(this->left.get());
-    if(varAccess && this->op == "=") {
-        DynamicObject value = this->right->visit(symbols);
-        symbols.setSymbol(std::make_shared<Token>(varAccess->getName()), value);
+        case BinaryOperator::EQUAL:
+            return [](const std::string& lhs, const std::string& rhs) {
+                return DynamicObject(lhs == rhs);
+            };
 
-        return value;
+        case BinaryOperator::NOT_EQUAL:
+            return [](const std::string& lhs, const std::string& rhs) {
+                return DynamicObject(lhs != rhs);
+            };
+
+        case BinaryOperator::ASSIGN:
+        case BinaryOperator::SUB:
+        case BinaryOperator::MUL:
+        case BinaryOperator::DIV:
+        case BinaryOperator::RDIV:
+        case BinaryOperator::MOD:
+        case BinaryOperator::BIT_AND:
+        case BinaryOperator::BIT_OR:
+        case BinaryOperator::BIT_XOR:
+        case BinaryOperator::SHIFT_LEFT:
+        case BinaryOperator::SHIFT_RIGHT:
+        case BinaryOperator::LOGIC_AND:
+        case BinaryOperator::LOGIC_OR:
+        case BinaryOperator::LESS:
+        case BinaryOperator::GREATER:
+        case BinaryOperator::LESS_EQUAL:
+        case BinaryOperator::GREATER_EQUAL:
+        case BinaryOperator::NIL_COALESCE:
+        case BinaryOperator::REGEX_MATCH:
+        case BinaryOperator::REGEX_NOT_MATCH:
+        case BinaryOperator::VECTOR_ADD:
+        case BinaryOperator::VECTOR_SUB:
+        case BinaryOperator::VECTOR_MUL:
+        case BinaryOperator::VECTOR_DIV:
+        case BinaryOperator::VECTOR_REM:
+        case BinaryOperator::VECTOR_BIT_AND:
+        case BinaryOperator::VECTOR_BIT_OR:
+        case BinaryOperator::VECTOR_BIT_XOR:
+        case BinaryOperator::VECTOR_SHIFT_LEFT:
+        case BinaryOperator::VECTOR_SHIFT_RIGHT:
+        default:
+            return nullptr;
     }
+}
 
-    DynamicObject lValue = this->left->visit(symbols);
-    DynamicObject rValue = this->right->visit(symbols);
+BinaryOperator BinaryExpression::resolveOperator(const std::string& image) {
+    static const std::unordered_map<std::string, BinaryOperator> operators = {
+        {"=", BinaryOperator::ASSIGN},
+        {"+", BinaryOperator::ADD},
+        {"-", BinaryOperator::SUB},
+        {"*", BinaryOperator::MUL},
+        {"/", BinaryOperator::DIV},
+        {"\\", BinaryOperator::RDIV},
+        {"%", BinaryOperator::MOD},
+        {"&", BinaryOperator::BIT_AND},
+        {"|", BinaryOperator::BIT_OR},
+        {"^", BinaryOperator::BIT_XOR},
+        {"<<", BinaryOperator::SHIFT_LEFT},
+        {">>", BinaryOperator::SHIFT_RIGHT},
+        {"&&", BinaryOperator::LOGIC_AND},
+        {"||", BinaryOperator::LOGIC_OR},
+        {"==", BinaryOperator::EQUAL},
+        {"!=", BinaryOperator::NOT_EQUAL},
+        {"<", BinaryOperator::LESS},
+        {">", BinaryOperator::GREATER},
+        {"<=", BinaryOperator::LESS_EQUAL},
+        {">=", BinaryOperator::GREATER_EQUAL},
+        {"?", BinaryOperator::NIL_COALESCE},
+        {"::", BinaryOperator::REGEX_MATCH},
+        {"!:", BinaryOperator::REGEX_NOT_MATCH},
+        {".+", BinaryOperator::VECTOR_ADD},
+        {".-", BinaryOperator::VECTOR_SUB},
+        {".*", BinaryOperator::VECTOR_MUL},
+        {"./", BinaryOperator::VECTOR_DIV},
+        {".%", BinaryOperator::VECTOR_REM},
+        {".&", BinaryOperator::VECTOR_BIT_AND},
+        {".|", BinaryOperator::VECTOR_BIT_OR},
+        {".^", BinaryOperator::VECTOR_BIT_XOR},
+        {".<<", BinaryOperator::VECTOR_SHIFT_LEFT},
+        {".>>", BinaryOperator::VECTOR_SHIFT_RIGHT}};
 
-    if(this->op == "+")
-        return lValue + rValue;
-    else if(this->op == "-")
-        return lValue - rValue;
-    else if(this->op == "/")
-        return lValue / rValue;
-    else if(this->op == "\\")
-        return rValue / lValue;
-    else if(this->op == "*")
-        return lValue * rValue;
-    else if(this->op == "%")
-        return lValue % rValue;
-    else if(this->op == "&")
-        return lValue & rValue;
-    else if(this->op == "|")
-        return lValue | rValue;
-    else if(this->op == "^")
-        return lValue ^ rValue;
-    else if(this->op == "&&")
-        return lValue && rValue;
-    else if(this->op == "||")
-        return lValue || rValue;
-    else if(this->op == "==")
-        return lValue == rValue;
-    else if(this->op == "!=")
-        return lValue != rValue;
-    else if(this->op == "<")
-        return lValue < rValue;
-    else if(this->op == ">")
-        return lValue > rValue;
-    else if(this->op == "<=")
-        return lValue <= rValue;
-    else if(this->op == ">=")
-        return lValue >= rValue;
-    else if(this->op == "<<")
-        return lValue << rValue;
-    else if(this->op == ">>")
-        return lValue >> rValue;
-    else if(this->op == "?")
-        return !lValue.isNil() ? lValue : rValue;
-    else if(this->op == "::") {
-        if(lValue.isRegex() && rValue.isString())
-            return DynamicObject(std::regex_match(
-                rValue.getString(), lValue.getRegex()->getRegex()));
-        else if(lValue.isString() && rValue.isRegex())
-            return DynamicObject(std::regex_match(
-                lValue.getString(), rValue.getRegex()->getRegex()));
-    } else if(this->op == "!:") {
-        if(lValue.isRegex() && rValue.isString())
-            return DynamicObject(!std::regex_match(
-                rValue.getString(), lValue.getRegex()->getRegex()));
-        else if(lValue.isString() && rValue.isRegex())
-            return DynamicObject(!std::regex_match(
-                lValue.getString(), rValue.getRegex()->getRegex()));
-    } else if(this->op == ".+") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorAdd(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorAdd(lValue);
-    } else if(this->op == ".-") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorSub(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorSub(lValue);
-    } else if(this->op == "./") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorDiv(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorDiv(lValue);
-    } else if(this->op == ".*") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorMul(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorMul(lValue);
-    } else if(this->op == ".%") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorRem(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorRem(lValue);
-    } else if(this->op == ".|") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorBitwiseOr(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorBitwiseOr(lValue);
-    } else if(this->op == ".&") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorBitwiseAnd(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorBitwiseAnd(lValue);
-    } else if(this->op == ".^") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorBitwiseXor(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorBitwiseXor(lValue);
-    } else if(this->op == ".<<") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorShiftLeft(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorShiftLeft(lValue);
-    } else if(this->op == ".>>") {
-        if(lValue.isNumber() && rValue.isArray())
-            return lValue.vectorShiftRight(rValue);
-        else if(lValue.isArray() && rValue.isNumber())
-            return rValue.vectorShiftRight(lValue);
+    auto resolved = operators.find(image);
+    if(resolved == operators.end())
+        throw std::invalid_argument("Unknown binary operator: " + image);
+
+    return resolved->second;
+}
+
+DynamicObject BinaryExpression::applyOperator(
+    const std::shared_ptr<Token>& address, BinaryOperator op,
+    const DynamicObject& lValue, const DynamicObject& rValue) {
+    if(lValue.isNumber() && rValue.isNumber()) {
+        if(NumberHandler number = BinaryExpression::numberHandler(op))
+            return number(lValue.getNumber(), rValue.getNumber());
+    } else if(lValue.isString() && rValue.isString()) {
+        if(StringHandler string = BinaryExpression::stringHandler(op))
+            return string(lValue.getString(), rValue.getString());
+    }
+
+    switch(op) {
+        case BinaryOperator::ADD:
+            return lValue + rValue;
+
+        case BinaryOperator::SUB:
+            return lValue - rValue;
+
+        case BinaryOperator::MUL:
+            return lValue * rValue;
+
+        case BinaryOperator::DIV:
+            return lValue / rValue;
+
+        case BinaryOperator::RDIV:
+            return rValue / lValue;
+
+        case BinaryOperator::MOD:
+            return lValue % rValue;
+
+        case BinaryOperator::BIT_AND:
+            return lValue & rValue;
+
+        case BinaryOperator::BIT_OR:
+            return lValue | rValue;
+
+        case BinaryOperator::BIT_XOR:
+            return lValue ^ rValue;
+
+        case BinaryOperator::SHIFT_LEFT:
+            return lValue << rValue;
+
+        case BinaryOperator::SHIFT_RIGHT:
+            return lValue >> rValue;
+
+        case BinaryOperator::LOGIC_AND:
+            return lValue && rValue;
+
+        case BinaryOperator::LOGIC_OR:
+            return lValue || rValue;
+
+        case BinaryOperator::EQUAL:
+            return DynamicObject(lValue == rValue);
+
+        case BinaryOperator::NOT_EQUAL:
+            return DynamicObject(lValue != rValue);
+
+        case BinaryOperator::LESS:
+            return lValue < rValue;
+
+        case BinaryOperator::GREATER:
+            return lValue > rValue;
+
+        case BinaryOperator::LESS_EQUAL:
+            return lValue <= rValue;
+
+        case BinaryOperator::GREATER_EQUAL:
+            return lValue >= rValue;
+
+        case BinaryOperator::NIL_COALESCE:
+            return !lValue.isNil() ? lValue : rValue;
+
+        case BinaryOperator::REGEX_MATCH:
+            if(lValue.isRegex() && rValue.isString())
+                return DynamicObject(std::regex_match(
+                    rValue.getString(), lValue.getRegex()->getRegex()));
+            else if(lValue.isString() && rValue.isRegex())
+                return DynamicObject(std::regex_match(
+                    lValue.getString(), rValue.getRegex()->getRegex()));
+            break;
+
+        case BinaryOperator::REGEX_NOT_MATCH:
+            if(lValue.isRegex() && rValue.isString())
+                return DynamicObject(!std::regex_match(
+                    rValue.getString(), lValue.getRegex()->getRegex()));
+            else if(lValue.isString() && rValue.isRegex())
+                return DynamicObject(!std::regex_match(
+                    lValue.getString(), rValue.getRegex()->getRegex()));
+            break;
+
+        case BinaryOperator::VECTOR_ADD:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorAdd(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorAdd(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_SUB:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorSub(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorSub(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_DIV:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorDiv(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorDiv(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_MUL:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorMul(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorMul(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_REM:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorRem(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorRem(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_BIT_OR:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorBitwiseOr(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorBitwiseOr(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_BIT_AND:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorBitwiseAnd(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorBitwiseAnd(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_BIT_XOR:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorBitwiseXor(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorBitwiseXor(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_SHIFT_LEFT:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorShiftLeft(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorShiftLeft(lValue);
+            break;
+
+        case BinaryOperator::VECTOR_SHIFT_RIGHT:
+            if(lValue.isNumber() && rValue.isArray())
+                return lValue.vectorShiftRight(rValue);
+            else if(lValue.isArray() && rValue.isNumber())
+                return rValue.vectorShiftRight(lValue);
+            break;
+
+        case BinaryOperator::ASSIGN:
+        default:
+            break;
     }
 
-    throw ASTNodeException(std::move(this->address),
-                           "Unsupported operation for type '" +
-                               lValue.objectType() + "' and '" +
-                               rValue.objectType() + "'.");
+    throw ASTNodeException(address, "Unsupported operation for type '" +
+                                        lValue.objectType() + "' and '" +
+                                        rValue.objectType() + "'.");
+}
 
-    return {};
+void BinaryExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->left);
+    callback(this->right);
 }
@@ -17,18 +17,30 @@
  */
 
 #include <memory>
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/expression/BlockExpression.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
+const std::vector<std::shared_ptr<ASTNode>>& BlockExpression::getStatements()
+    const {
+    return this->statements;
+}
+
 DynamicObject BlockExpression::visit(SymbolTable& symbols) {
-    SymbolTable& table(symbols);
     DynamicObject value;
 
-    try {
-        for(auto& stmt : this->statements) value = stmt->visit(table);
-    } catch(const TerminativeReturnSignal& rs) {
-        return rs.getObject();
+    for(auto& stmt : this->statements) {
+        value = stmt->visit(symbols);
+
+        if(Completion::isAbrupt()) {
+            Completion::consume(CompletionType::RETURN);
+            break;
+        }
     }
 
     return value;
 }
+
+void BlockExpression::forEachChild(const ASTChildCallback& callback) {
+    for(auto& child : this->statements) callback(child);
+}
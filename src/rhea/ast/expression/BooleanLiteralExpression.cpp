@@ -20,6 +20,10 @@
 #include <rhea/core/DynamicObject.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
+bool BooleanLiteralExpression::getValue() const {
+    return this->value;
+}
+
 DynamicObject BooleanLiteralExpression::visit(SymbolTable& symbols
                                               __attribute__((unused))) {
     return DynamicObject(this->value);
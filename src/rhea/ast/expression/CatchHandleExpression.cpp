@@ -17,28 +17,54 @@
  */
 
 #include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/expression/CatchHandleExpression.hpp>
 #include <rhea/core/SymbolTable.hpp>
 #include <rhea/parser/Token.hpp>
 
+const std::shared_ptr<ASTNode>& CatchHandleExpression::getCatchBlock() const {
+    return this->catchBlock;
+}
+
+const std::shared_ptr<ASTNode>& CatchHandleExpression::getHandleBlock() const {
+    return this->handleBlock;
+}
+
+const std::shared_ptr<Token>& CatchHandleExpression::getHandler() const {
+    return this->handler;
+}
+
+const std::shared_ptr<ASTNode>& CatchHandleExpression::getFinalBlock() const {
+    return this->finalBlock;
+}
+
 DynamicObject CatchHandleExpression::visit(SymbolTable& symbols) {
-    SymbolTable localTable(symbols);
     DynamicObject object = {};
 
     try {
-        object = this->catchBlock->visit(localTable);
+        object = this->catchBlock->visit(symbols);
     } catch(const TerminativeThrowSignal& throwSig) {
-        std::string handleName = this->handler->getImage();
-        if(localTable.hasSymbol(handleName))
+        if(symbols.hasSymbol(this->handler->getImage()))
             throw ASTNodeException(
-                std::move(this->address),
+                this->address,
                 "Handle name for catch-handle is already in-use.");
 
-        localTable.setSymbol(std::move(this->handler), throwSig.getObject());
-        object = this->handleBlock->visit(localTable);
+        auto handleTable = std::make_shared<SymbolTable>(
+            this->handlerLayout, symbols.getReference());
+        handleTable->setSymbol(this->handler, {SymbolScope::LOCAL, 0, 0},
+                               throwSig.getObject());
+
+        object = this->handleBlock->visit(*handleTable);
     }
 
-    if(this->finalBlock) this->finalBlock->visit(localTable);
+    if(this->finalBlock && !Completion::isAbrupt())
+        this->finalBlock->visit(symbols);
 
     return object;
 }
+
+void CatchHandleExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->catchBlock);
+    callback(this->handleBlock);
+    callback(this->finalBlock);
+}
@@ -17,31 +17,81 @@
  */
 
 #include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/TailCall.hpp>
 #include <rhea/ast/expression/FunctionCallExpression.hpp>
+#include <rhea/core/NativeBinding.hpp>
 #include <rhea/core/Runtime.hpp>
 #include <rhea/parser/Parser.hpp>
 
+const std::shared_ptr<ASTNode>& FunctionCallExpression::getCallable() const {
+    return this->callable;
+}
+
+const std::vector<std::shared_ptr<ASTNode>>&
+FunctionCallExpression::getArguments() const {
+    return this->arguments;
+}
+
+bool FunctionCallExpression::isTailCall() const {
+    return this->tail;
+}
+
+void FunctionCallExpression::setTailCall(bool _tail) {
+    this->tail = _tail;
+}
+
+DynamicObject FunctionCallExpression::resolve(SymbolTable& symbols) {
+    if(this->callee == nullptr ||
+       this->callee->getSymbolAddress().scope != SymbolScope::GLOBAL)
+        return this->callable->visit(symbols);
+
+    const SymbolTable& global = symbols.getRoot();
+    DynamicObject func;
+
+    if(this->cache.lookup(global, func)) return func;
+
+    uint64_t epoch = SymbolTable::getEpoch();
+    func = this->callable->visit(symbols);
+
+    if(func.isFunction() || func.isNative())
+        this->cache.update(global, epoch, func);
+    return func;
+}
+
 DynamicObject FunctionCallExpression::visit(SymbolTable& symbols) {
-    auto func = this->callable->visit(symbols);
+    DynamicObject func = this->resolve(symbols);
     if(!func.isFunction() && !func.isNative())
-        throw ASTNodeException(std::move(this->address),
-                               "Expression is not a function.");
+        throw ASTNodeException(this->address, "Expression is not a function.");
 
-    auto caller = func.getCallable();
     std::vector<DynamicObject> args;
+    args.reserve(this->arguments.size());
 
     for(auto& arg : this->arguments) args.push_back(arg->visit(symbols));
 
     if(func.isNative()) {
-        auto nativeFunc = func.getNativeFunction();
+        NativeBinding* binding = func.getNativeBinding();
+        binding->expect(this->address, args.size());
+        auto nativeFunc = binding->resolve(this->address);
 
         if(nativeFunc == nullptr)
-            throw ASTNodeException(std::move(this->address),
-                                   "Native function is nil.");
+            throw ASTNodeException(this->address, "Native function is nil.");
 
-        return (*nativeFunc)(std::move(this->address), symbols, args,
+        return (*nativeFunc)(this->address, symbols, args,
                              Runtime::isUnsafeMode());
     }
 
-    return caller->call(symbols, args);
+    if(this->tail) {
+        TailCall::schedule(func.getCallable(), std::move(args));
+        return {};
+    }
+
+    return func.getCallable()->call(symbols, args);
+}
+
+void FunctionCallExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->callable);
+    for(auto& argument : this->arguments) callback(argument);
+
+    this->callee =
+        dynamic_cast<VariableAccessExpression*>(this->callable.get());
 }
@@ -16,11 +16,13 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <Rhea.hpp>
 #include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/TailCall.hpp>
 #include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+#include <rhea/core/CallFrame.hpp>
 #include <rhea/core/SymbolTable.hpp>
 #include <rhea/parser/Token.hpp>
+#include <rhea/vm/VirtualMachine.hpp>
 
 FunctionDeclarationExpression& FunctionDeclarationExpression::operator=(
     FunctionDeclarationExpression&& other) noexcept {
@@ -28,33 +30,125 @@ FunctionDeclarationExpression& FunctionDeclarationExpression::operator=(
         this->address = std::move(other.address);
         this->parameters = std::move(other.parameters);
         this->body = std::move(other.body);
+        this->bytecode = std::move(other.bytecode);
+        this->layout = std::move(other.layout);
+        this->closure = std::move(other.closure);
+        this->capturing = other.capturing;
     }
 
     return *this;
 }
 
-DynamicObject FunctionDeclarationExpression::visit(SymbolTable& symbols
-                                                   __attribute__((unused))) {
-    return DynamicObject(
-        std::make_shared<FunctionDeclarationExpression>(std::move(*this)));
+std::shared_ptr<const SymbolLayout>
+FunctionDeclarationExpression::parameterLayout(
+    const std::vector<std::shared_ptr<Token>>& parameters) {
+    auto names = std::make_shared<SymbolLayout>();
+    for(const auto& parameter : parameters)
+        names->push_back(parameter->getImage());
+
+    return names;
+}
+
+DynamicObject FunctionDeclarationExpression::visit(SymbolTable& symbols) {
+    return DynamicObject(this->bind(symbols));
 }
 
 Token FunctionDeclarationExpression::getFunctionImage() const {
     return *this->address;
 }
 
-DynamicObject FunctionDeclarationExpression::call(
+const std::vector<std::shared_ptr<Token>>&
+FunctionDeclarationExpression::getParameters() const {
+    return this->parameters;
+}
+
+const std::shared_ptr<ASTNode>& FunctionDeclarationExpression::getBody() const {
+    return this->body;
+}
+
+const std::shared_ptr<const SymbolLayout>&
+FunctionDeclarationExpression::getLayout() const {
+    return this->layout;
+}
+
+bool FunctionDeclarationExpression::isCapturing() const {
+    return this->capturing;
+}
+
+void FunctionDeclarationExpression::setBytecode(
+    std::shared_ptr<Bytecode> _bytecode) {
+    this->bytecode = std::move(_bytecode);
+}
+
+void FunctionDeclarationExpression::setLayout(
+    std::shared_ptr<const SymbolLayout> _layout, bool _capturing) {
+    this->layout = std::move(_layout);
+    this->capturing = _capturing;
+}
+
+std::shared_ptr<FunctionDeclarationExpression>
+FunctionDeclarationExpression::bind(SymbolTable& symbols) {
+    auto function = std::make_shared<FunctionDeclarationExpression>(
+        this->address, this->parameters, this->body);
+
+    function->bytecode = this->bytecode;
+    function->layout = this->layout;
+    function->capturing = this->capturing;
+
+    if(this->capturing) function->closure = symbols.getReference();
+    return function;
+}
+
+DynamicObject FunctionDeclarationExpression::invoke(
     const SymbolTable& symbols, const std::vector<DynamicObject>& args) {
     if(args.size() != this->parameters.size())
-        throw ASTNodeException(std::move(this->address),
+        throw ASTNodeException(this->address,
                                "Argument count mismatch, expecting " +
                                    std::to_string(this->parameters.size()) +
                                    " but go only " +
                                    std::to_string(args.size()) + ".");
 
-    SymbolTable localSymbols(const_cast<SymbolTable&>(symbols));
-    parsync(size_t i = 0; i < args.size(); ++i)
-        localSymbols.setSymbol(this->parameters[i], std::move(args).at(i));
+    // Bytecode that keeps its locals in registers runs without a frame;
+    // it only ever reaches globals, which live in the root.
+    if(this->bytecode && this->bytecode->getLocals())
+        return VirtualMachine::execute(
+            *this->bytecode, const_cast<SymbolTable&>(symbols).getRoot(),
+            args);
+
+    CallFrame localSymbols(this->layout,
+                           this->closure ? this->closure
+                                         : const_cast<SymbolTable&>(symbols)
+                                               .getRoot()
+                                               .getReference());
+
+    for(size_t i = 0; i < args.size(); ++i)
+        localSymbols->setSymbol(this->parameters[i],
+                                {SymbolScope::LOCAL, 0,
+                                 static_cast<uint32_t>(i)},
+                                args[i]);
+
+    if(this->bytecode)
+        return VirtualMachine::execute(*this->bytecode, *localSymbols);
+
+    return this->body->visit(*localSymbols);
+}
+
+DynamicObject FunctionDeclarationExpression::call(
+    const SymbolTable& symbols, const std::vector<DynamicObject>& args) {
+    DynamicObject value = this->invoke(symbols, args);
+    if(!TailCall::isPending()) return value;
+
+    std::vector<DynamicObject> arguments;
+    do {
+        std::shared_ptr<FunctionDeclarationExpression> function =
+            TailCall::take(arguments);
+        value = function->invoke(symbols, arguments);
+    } while(TailCall::isPending());
+
+    return value;
+}
 
-    return this->body->visit(localSymbols);
+void FunctionDeclarationExpression::forEachChild(
+    const ASTChildCallback& callback) {
+    callback(this->body);
 }
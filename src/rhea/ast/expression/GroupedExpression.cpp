@@ -19,6 +19,14 @@
 #include <memory>
 #include <rhea/ast/expression/GroupedExpression.hpp>
 
+const std::shared_ptr<ASTNode>& GroupedExpression::getExpression() const {
+    return this->expression;
+}
+
 DynamicObject GroupedExpression::visit(SymbolTable& symbols) {
     return this->expression->visit(symbols);
 }
+
+void GroupedExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
@@ -18,6 +18,18 @@
 
 #include <rhea/ast/expression/IfElseExpression.hpp>
 
+const std::shared_ptr<ASTNode>& IfElseExpression::getCondition() const {
+    return this->condition;
+}
+
+const std::shared_ptr<ASTNode>& IfElseExpression::getThenBranch() const {
+    return this->thenBranch;
+}
+
+const std::shared_ptr<ASTNode>& IfElseExpression::getElseBranch() const {
+    return this->elseBranch;
+}
+
 DynamicObject IfElseExpression::visit(SymbolTable& symbols) {
     DynamicObject condValue = this->condition->visit(symbols);
 
@@ -28,3 +40,9 @@ DynamicObject IfElseExpression::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void IfElseExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->condition);
+    callback(this->thenBranch);
+    callback(this->elseBranch);
+}
@@ -19,16 +19,23 @@
 #include <rhea/ast/expression/LockExpression.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
+const std::shared_ptr<Token>& LockExpression::getVariable() const {
+    return this->variable;
+}
+
+const std::shared_ptr<ASTNode>& LockExpression::getBody() const {
+    return this->body;
+}
+
+LockMode LockExpression::getMode() const {
+    return this->mode;
+}
+
 DynamicObject LockExpression::visit(SymbolTable& symbols) {
-    std::string varName = this->variable->getImage();
-    symbols.lock(varName, symbols);
+    LockTable::Guard guard = symbols.lock(this->variable, this->mode);
+    return this->body->visit(symbols);
+}
 
-    try {
-        DynamicObject value = this->body->visit(symbols);
-        symbols.unlock(varName, symbols);
-        return value;
-    } catch(...) {
-        symbols.unlock(varName, symbols);
-        throw;
-    }
+void LockExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->body);
 }
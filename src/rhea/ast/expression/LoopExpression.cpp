@@ -16,24 +16,47 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/expression/LoopExpression.hpp>
 
+const std::shared_ptr<ASTNode>& LoopExpression::getInitial() const {
+    return this->initial;
+}
+
+const std::shared_ptr<ASTNode>& LoopExpression::getCondition() const {
+    return this->condition;
+}
+
+const std::shared_ptr<ASTNode>& LoopExpression::getPostExpression() const {
+    return this->postexpr;
+}
+
+const std::shared_ptr<ASTNode>& LoopExpression::getBody() const {
+    return this->body;
+}
+
 DynamicObject LoopExpression::visit(SymbolTable& symbols) {
     DynamicObject value;
     this->initial->visit(symbols);
 
     while(this->condition->visit(symbols).booleanEquivalent()) {
-        try {
-            value = this->body->visit(symbols);
-        } catch(const TerminativeBreakSignal& breakSig) {
-            break;
-        } catch(const TerminativeContinueSignal& continueSig) {
-            this->postexpr->visit(symbols);
-            continue;
-        }
+        DynamicObject result = this->body->visit(symbols);
+
+        if(Completion::isAbrupt()) {
+            if(Completion::consume(CompletionType::BREAK)) break;
+            if(!Completion::consume(CompletionType::CONTINUE)) return result;
+        } else
+            value = std::move(result);
 
         this->postexpr->visit(symbols);
     }
 
     return value;
 }
+
+void LoopExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->initial);
+    callback(this->condition);
+    callback(this->postexpr);
+    callback(this->body);
+}
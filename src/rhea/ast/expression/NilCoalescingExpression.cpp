@@ -18,9 +18,22 @@
 
 #include <rhea/ast/expression/NilCoalescingExpression.hpp>
 
+const std::shared_ptr<ASTNode>& NilCoalescingExpression::getLeft() const {
+    return this->left;
+}
+
+const std::shared_ptr<ASTNode>& NilCoalescingExpression::getRight() const {
+    return this->right;
+}
+
 DynamicObject NilCoalescingExpression::visit(SymbolTable& symbols) {
     DynamicObject leftValue = this->left->visit(symbols);
     if(!leftValue.isNil()) return leftValue;
 
     return this->right->visit(symbols);
 }
+
+void NilCoalescingExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->left);
+    callback(this->right);
+}
@@ -18,6 +18,10 @@
 
 #include <rhea/ast/expression/NumberLiteralExpression.hpp>
 
+double NumberLiteralExpression::getValue() const {
+    return this->value;
+}
+
 DynamicObject NumberLiteralExpression::visit(SymbolTable& symbols
                                              __attribute__((unused))) {
     return DynamicObject(this->value);
@@ -16,120 +16,44 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <exception>
-#include <functional>
-#include <future>
-#include <iostream>
 #include <memory>
-#include <rhea/ast/ASTNodeException.hpp>
-#include <rhea/ast/TerminativeSignal.hpp>
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/expression/ParallelExpression.hpp>
-#include <rhea/core/Runtime.hpp>
 #include <rhea/core/SymbolTable.hpp>
-#include <rhea/parser/LexicalAnalysisException.hpp>
-#include <rhea/parser/ParserException.hpp>
-#include <rhea/util/RandomUtil.hpp>
-#include <rhea/util/Render.hpp>
-#include <rhea/util/ThreadId.hpp>
-#include <thread>
+#include <rhea/core/TaskScheduler.hpp>
 
-DynamicObject ParallelExpression::visit(SymbolTable& symbols) {
-#ifndef __EMSCRIPTEN__
-    symbols.addParallelism(std::async(std::launch::async, [expr =
-                                                               this->expression,
-                                                           symbols]() mutable {
-#endif
-        try {
-#ifndef __EMSCRIPTEN__
-            expr->visit(symbols);
-#else
-        this->expression->visit(symbols);
-#endif
-        } catch(const std::system_error& exc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mSystem Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(exc.what());
-            RheaUtil::renderError("\u001b[0m\r\n");
-        } catch(const ASTNodeException& nodeExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(nodeExc.what());
-            RheaUtil::renderError("\u001b[0m\r\n                 ");
-            RheaUtil::renderError(nodeExc.getAddress()->toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const LexicalAnalysisException& lexAnlExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mLexical Error\u001b[0m]:\r\n\t");
-            RheaUtil::renderError(lexAnlExc.what());
-            RheaUtil::renderError("\r\n");
-        } catch(const ParserException& parserExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mParser Error\u001b[0m]:  \u001b[3;37m");
-            RheaUtil::renderError(parserExc.what());
-            RheaUtil::renderError("\u001b[0m\r\n                 ");
-            RheaUtil::renderError(parserExc.getAddress()->toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const TerminativeBreakSignal& breakExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: "
-                "\u001b[3;37mInvalid break statement signal caught.\u001b[0m"
-                "\r\n                 ");
-            RheaUtil::renderError(breakExc.getAddress().toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const TerminativeContinueSignal& continueExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: "
-                "\u001b[3;37mInvalid continue statement signal caught.\u001b[0m"
-                "\r\n                 ");
-            RheaUtil::renderError(continueExc.getAddress().toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const TerminativeReturnSignal& retExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
+const std::shared_ptr<ASTNode>& ParallelExpression::getExpression() const {
+    return this->expression;
+}
 
-            RheaUtil::renderError("\u001b[0;93m");
-            RheaUtil::renderError(retExc.getObject().toString());
-            RheaUtil::renderError("\u001b[0m\r\n");
-        } catch(const TerminativeThrowSignal& throwExc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
+// Whatever the expression throws is kept by the task: await rethrows it in
+// the awaiting thread, and an unawaited failure is reported when the task
+// is joined. A task never tears down the runtime other threads still use.
+DynamicObject ParallelExpression::evaluate(
+    const std::shared_ptr<ASTNode>& expression, SymbolTable& symbols) {
+    DynamicObject value = expression->visit(symbols);
+    Completion::raise(value);
 
-            RheaUtil::renderError(
-                "[\u001b[1;31mUncaught Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(throwExc.getObject().toString());
-            RheaUtil::renderError("\u001b[0m\r\n                  ");
-            RheaUtil::renderError(throwExc.getAddress()->toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const std::exception& exc) {
-            symbols.waitForTasks();
-            Runtime::cleanUp();
+    return value;
+}
 
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(exc.what());
-            RheaUtil::renderError("\u001b[0m\r\n");
-        }
+DynamicObject ParallelExpression::visit(SymbolTable& symbols) {
 #ifndef __EMSCRIPTEN__
-    }));
+    std::shared_ptr<Task> task = TaskScheduler::getInstance().submit(
+        [expr = this->expression, symbols]() mutable {
+            return ParallelExpression::evaluate(expr, symbols);
+        });
+#else
+    std::shared_ptr<Task> task = std::make_shared<Task>([this, &symbols]() {
+        return ParallelExpression::evaluate(this->expression, symbols);
+    });
+    task->run();
 #endif
 
-    return {};
+    symbols.addParallelism(task);
+    return DynamicObject(task);
+}
+
+void ParallelExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
 }
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/Completion.hpp>
+#include <rhea/ast/expression/ParallelLoopExpression.hpp>
+#include <rhea/core/Task.hpp>
+#include <rhea/core/TaskScheduler.hpp>
+
+const std::shared_ptr<AssignmentExpression>&
+ParallelLoopExpression::getInitial() const {
+    return this->initial;
+}
+
+const std::shared_ptr<ASTNode>& ParallelLoopExpression::getBound() const {
+    return this->bound;
+}
+
+const std::shared_ptr<ASTNode>& ParallelLoopExpression::getStep() const {
+    return this->step;
+}
+
+const std::shared_ptr<ASTNode>& ParallelLoopExpression::getBody() const {
+    return this->body;
+}
+
+const std::vector<ParallelReduction>& ParallelLoopExpression::getReductions()
+    const {
+    return this->reductions;
+}
+
+const std::shared_ptr<const SymbolLayout>& ParallelLoopExpression::getLayout()
+    const {
+    return this->layout;
+}
+
+void ParallelLoopExpression::setLayout(
+    std::shared_ptr<const SymbolLayout> _layout) {
+    this->layout = std::move(_layout);
+}
+
+SymbolAddress ParallelLoopExpression::slotOf(const std::string& name) const {
+    auto slot = std::find(this->layout->begin(), this->layout->end(), name);
+    return {SymbolScope::LOCAL, 0,
+            static_cast<uint32_t>(slot - this->layout->begin())};
+}
+
+size_t ParallelLoopExpression::iterations(double first, double last,
+                                          double delta) const {
+    bool ascending = this->comparison == BinaryOperator::LESS ||
+                     this->comparison == BinaryOperator::LESS_EQUAL;
+    bool inclusive = this->comparison == BinaryOperator::LESS_EQUAL ||
+                     this->comparison == BinaryOperator::GREATER_EQUAL;
+
+    double span = ascending ? last - first : first - last;
+    if(span < 0.0 || (!inclusive && span <= 0.0)) return 0;
+
+    double stride = ascending ? delta : -delta;
+    if(stride <= 0.0)
+        throw ASTNodeException(this->address,
+                               "Parallel loop step does not move toward its "
+                               "bound.");
+
+    double steps = span / stride;
+    return inclusive ? static_cast<size_t>(std::floor(steps)) + 1
+                     : static_cast<size_t>(std::ceil(steps));
+}
+
+DynamicObject ParallelLoopExpression::identity(
+    ReductionOperator op, const DynamicObject& initialValue) const {
+    switch(op) {
+        case ReductionOperator::ADD:
+            if(initialValue.isString()) return DynamicObject(std::string());
+            if(!initialValue.isArray()) return DynamicObject(0.0);
+
+            // Adding to an array appends to it, so it reduces like append.
+            return DynamicObject(
+                std::make_shared<std::vector<DynamicObject>>());
+
+        case ReductionOperator::MUL:
+            return DynamicObject(1.0);
+
+        case ReductionOperator::APPEND:
+            return DynamicObject(
+                std::make_shared<std::vector<DynamicObject>>());
+
+        case ReductionOperator::MIN:
+        case ReductionOperator::MAX:
+        default:
+            return initialValue;
+    }
+}
+
+DynamicObject ParallelLoopExpression::merge(ReductionOperator op,
+                                            const DynamicObject& left,
+                                            const DynamicObject& right) const {
+    switch(op) {
+        case ReductionOperator::ADD:
+            if(!left.isArray() || !right.isArray()) return left + right;
+            return this->merge(ReductionOperator::APPEND, left, right);
+
+        case ReductionOperator::MUL:
+            return left * right;
+
+        case ReductionOperator::MIN:
+            return (right < left).booleanEquivalent() ? right : left;
+
+        case ReductionOperator::MAX:
+            return (right > left).booleanEquivalent() ? right : left;
+
+        case ReductionOperator::APPEND: {
+            if(!left.isArray() || !right.isArray())
+                throw ASTNodeException(this->address,
+                                       "Append reduction needs an array.");
+
+            auto merged =
+                std::make_shared<std::vector<DynamicObject>>(*left.getArray());
+            merged->insert(merged->end(), right.getArray()->begin(),
+                           right.getArray()->end());
+
+            return DynamicObject(merged);
+        }
+
+        default:
+            return left;
+    }
+}
+
+DynamicObject ParallelLoopExpression::visit(SymbolTable& symbols) {
+    const auto& counter = this->initial->getVariable();
+    DynamicObject start = this->initial->visit(symbols),
+                  last = this->bound->visit(symbols),
+                  stride = this->step->visit(symbols);
+
+    if(!start.isNumber() || !last.isNumber() || !stride.isNumber())
+        throw ASTNodeException(this->address,
+                               "Parallel loop bounds must be numbers.");
+
+    double first = start.getNumber(),
+           delta = this->descending ? -stride.getNumber() : stride.getNumber();
+    size_t count = this->iterations(first, last.getNumber(), delta);
+
+    std::vector<DynamicObject> values;
+    for(const auto& [op, variable] : this->reductions) {
+        values.push_back(variable->visit(symbols));
+
+        if(op == ReductionOperator::APPEND && !values.back().isArray())
+            throw ASTNodeException(this->address,
+                                   "Append reduction needs an array.");
+    }
+
+    size_t chunks = std::min(count, TaskScheduler::getThreadCount() * 4);
+    size_t size = chunks == 0 ? 0 : (count + chunks - 1) / chunks;
+    chunks = size == 0 ? 0 : (count + size - 1) / size;
+
+    // The lowest chunk that stopped early. Chunks below it run to the end
+    // and chunks above it bail out, so the reductions always cover exactly
+    // the iterations a sequential loop would have run.
+    std::atomic<size_t> stopped(chunks);
+    std::vector<std::shared_ptr<Task>> tasks;
+    std::vector<DynamicObject> returned(chunks);
+    std::vector<char> returning(chunks, 0);
+    std::shared_ptr<SymbolTable> parent = symbols.getReference();
+
+    auto stop = [&stopped](size_t chunk) {
+        size_t lowest = stopped.load(std::memory_order_relaxed);
+        while(chunk < lowest &&
+              !stopped.compare_exchange_weak(lowest, chunk,
+                                             std::memory_order_relaxed))
+            ;
+    };
+
+    for(size_t chunk = 0; chunk < chunks; chunk++) {
+        size_t begin = chunk * size, end = std::min(count, begin + size);
+        auto work = [this, &parent, chunk, begin, end, first, delta, &counter,
+                     &values, &returned, &returning, &stopped, &stop]() {
+            auto local = std::make_shared<SymbolTable>(this->layout, parent);
+            for(size_t i = 0; i < this->reductions.size(); i++) {
+                const auto& [op, variable] = this->reductions[i];
+                local->setSymbol(variable->getNameToken(),
+                                 this->slotOf(variable->getName().getImage()),
+                                 this->identity(op, values[i]));
+            }
+
+            SymbolAddress index = this->slotOf(counter->getName().getImage());
+            try {
+                for(size_t iteration = begin;
+                    iteration < end &&
+                    chunk < stopped.load(std::memory_order_relaxed);
+                    iteration++) {
+                    double value =
+                        first + static_cast<double>(iteration) * delta;
+                    local->setSymbol(counter->getNameToken(), index,
+                                     DynamicObject(value));
+
+                    DynamicObject result = this->body->visit(*local);
+
+                    if(!Completion::isAbrupt() ||
+                       Completion::consume(CompletionType::CONTINUE))
+                        continue;
+
+                    if(!Completion::consume(CompletionType::BREAK)) {
+                        Completion::consume(Completion::current());
+                        returned[chunk] = std::move(result);
+                        returning[chunk] = 1;
+                    }
+
+                    stop(chunk);
+                    break;
+                }
+            }
+            catch(...) {
+                stop(chunk);
+                throw;
+            }
+
+            auto partials = std::make_shared<std::vector<DynamicObject>>();
+            for(const auto& [op, variable] : this->reductions)
+                partials->push_back(local->getSymbol(
+                    variable->getNameToken(),
+                    this->slotOf(variable->getName().getImage())));
+
+            return DynamicObject(partials);
+        };
+
+#ifndef __EMSCRIPTEN__
+        tasks.push_back(TaskScheduler::getInstance().submit(work));
+#else
+        tasks.push_back(std::make_shared<Task>(work));
+        tasks.back()->run();
+#endif
+    }
+
+    for(const auto& task : tasks)
+        if(!task->isFinished()) TaskScheduler::getInstance().wait(task);
+
+    std::vector<std::shared_ptr<std::vector<DynamicObject>>> results;
+    for(const auto& task : tasks) results.push_back(task->get().getArray());
+
+    // A ret or break ends the loop in the lowest chunk that stopped; the
+    // partials of the chunks past it are dropped.
+    size_t stopper = stopped.load(std::memory_order_relaxed);
+    if(stopper < chunks && returning[stopper] != 0) {
+        Completion::signal(CompletionType::RETURN, this->address);
+        return returned[stopper];
+    }
+
+    size_t merged = stopper < chunks ? stopper + 1 : chunks;
+    for(size_t chunk = 0; chunk < merged; chunk++)
+        for(size_t i = 0; i < values.size(); i++)
+            values[i] = this->merge(this->reductions[i].first, values[i],
+                                    (*results[chunk])[i]);
+
+    for(size_t i = 0; i < values.size(); i++) {
+        const auto& variable = this->reductions[i].second;
+        symbols.setSymbol(variable->getNameToken(),
+                          variable->getSymbolAddress(), values[i]);
+    }
+
+    symbols.setSymbol(
+        counter->getNameToken(), counter->getSymbolAddress(),
+        DynamicObject(first + static_cast<double>(count) * delta));
+    return {};
+}
+
+void ParallelLoopExpression::forEachChild(const ASTChildCallback& callback) {
+    this->initial->forEachChild(callback);
+    callback(this->bound);
+    callback(this->step);
+    callback(this->body);
+}
@@ -19,6 +19,14 @@
 #include <rhea/ast/expression/RandomExpression.hpp>
 #include <rhea/util/RandomUtil.hpp>
 
+const std::shared_ptr<ASTNode>& RandomExpression::getThenBranch() const {
+    return this->thenBranch;
+}
+
+const std::shared_ptr<ASTNode>& RandomExpression::getElseBranch() const {
+    return this->elseBranch;
+}
+
 DynamicObject RandomExpression::visit(SymbolTable& symbols) {
     if(RheaUtil::randomBoolValue())
         return this->thenBranch->visit(symbols);
@@ -27,3 +35,8 @@ DynamicObject RandomExpression::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void RandomExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->thenBranch);
+    callback(this->elseBranch);
+}
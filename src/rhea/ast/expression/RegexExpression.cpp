@@ -18,7 +18,16 @@
 
 #include <rhea/ast/expression/RegexExpression.hpp>
 
+const std::string& RegexExpression::getPattern() const {
+    return this->regExpression;
+}
+
+void RegexExpression::setConstant(DynamicObject _constant) {
+    this->constant = std::move(_constant);
+}
+
 DynamicObject RegexExpression::visit(SymbolTable& symbols
                                      __attribute__((unused))) {
+    if(this->constant.isRegex()) return this->constant;
     return DynamicObject(std::make_shared<RegexWrapper>(this->regExpression));
 }
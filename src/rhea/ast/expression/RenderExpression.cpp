@@ -21,6 +21,18 @@
 #include <rhea/ast/expression/RenderExpression.hpp>
 #include <rhea/util/Render.hpp>
 
+const std::shared_ptr<ASTNode>& RenderExpression::getExpression() const {
+    return this->expression;
+}
+
+bool RenderExpression::isNewLine() const {
+    return this->newLine;
+}
+
+bool RenderExpression::isErrorStream() const {
+    return this->errorStream;
+}
+
 DynamicObject RenderExpression::visit(SymbolTable& symbols) {
     DynamicObject value = this->expression->visit(symbols);
     std::string str = value.toString();
@@ -39,3 +51,7 @@ DynamicObject RenderExpression::visit(SymbolTable& symbols) {
 
     return value;
 }
+
+void RenderExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
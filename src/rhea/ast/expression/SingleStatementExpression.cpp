@@ -17,16 +17,22 @@
  */
 
 #include <memory>
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/expression/SingleStatementExpression.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
+const std::shared_ptr<ASTNode>& SingleStatementExpression::getStatement()
+    const {
+    return this->statement;
+}
+
 DynamicObject SingleStatementExpression::visit(SymbolTable& symbols) {
-    SymbolTable table(std::make_shared<SymbolTable>(symbols));
-    try {
-        return this->statement->visit(table);
-    } catch(const TerminativeReturnSignal& rs) {
-        return rs.getObject();
-    }
+    DynamicObject value = this->statement->visit(symbols);
+    Completion::consume(CompletionType::RETURN);
+
+    return value;
+}
 
-    return {};
+void SingleStatementExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->statement);
 }
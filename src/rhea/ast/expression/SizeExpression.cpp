@@ -20,6 +20,10 @@
 #include <rhea/ast/expression/SizeExpression.hpp>
 #include <rhea/parser/Token.hpp>
 
+const std::shared_ptr<ASTNode>& SizeExpression::getExpression() const {
+    return this->expression;
+}
+
 DynamicObject SizeExpression::visit(SymbolTable& symbols) {
     DynamicObject value = this->expression->visit(symbols);
     if(value.isArray())
@@ -33,3 +37,7 @@ DynamicObject SizeExpression::visit(SymbolTable& symbols) {
 
     return DynamicObject(0.0f);
 }
+
+void SizeExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
@@ -18,7 +18,16 @@
 
 #include <rhea/ast/expression/StringLiteralExpression.hpp>
 
+const std::string& StringLiteralExpression::getValue() const {
+    return this->value;
+}
+
+void StringLiteralExpression::setConstant(DynamicObject _constant) {
+    this->constant = std::move(_constant);
+}
+
 DynamicObject StringLiteralExpression::visit(SymbolTable& symbols
                                              __attribute__((unused))) {
+    if(this->constant.isString()) return this->constant;
     return DynamicObject(this->value);
 }
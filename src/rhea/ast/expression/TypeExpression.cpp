@@ -20,7 +20,15 @@
 #include <rhea/ast/expression/TypeExpression.hpp>
 #include <rhea/parser/Token.hpp>
 
+const std::shared_ptr<ASTNode>& TypeExpression::getExpression() const {
+    return this->expression;
+}
+
 DynamicObject TypeExpression::visit(SymbolTable& symbols) {
     DynamicObject value = this->expression->visit(symbols);
     return DynamicObject(value.objectType());
 }
+
+void TypeExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
@@ -20,37 +20,113 @@
 #include <rhea/ast/ASTNodeException.hpp>
 #include <rhea/ast/expression/UnaryExpression.hpp>
 #include <rhea/parser/Token.hpp>
+#include <stdexcept>
+
+UnaryOperator UnaryExpression::getOperator() const {
+    return this->op;
+}
+
+const std::shared_ptr<ASTNode>& UnaryExpression::getExpression() const {
+    return this->expression;
+}
 
 DynamicObject UnaryExpression::visit(SymbolTable& symbols) {
     DynamicObject value = this->expression->visit(symbols);
 
-    if(this->op == "!")
-        return DynamicObject(!value.booleanEquivalent());
-    else if(value.isArray() && this->op == "~") {
-        std::vector<DynamicObject> objects = *value.getArray();
-        std::reverse(objects.begin(), objects.end());
-
-        return DynamicObject(
-            std::make_shared<std::vector<DynamicObject>>(objects));
-    } else if(value.isNumber()) {
-        if(this->op == "+")
-            return DynamicObject(+value.getNumber());
-        else if(this->op == "-")
-            return DynamicObject(-value.getNumber());
-        else if(this->op == "~")
-            return DynamicObject(
-                static_cast<double>(~static_cast<long>(value.getNumber())));
-    } else if(value.isString()) {
-        if(this->op == "*")
-            return DynamicObject((double)value.getString().length());
-        else if(this->op == "~") {
-            std::string str = value.getString();
-            std::reverse(str.begin(), str.end());
-
-            return DynamicObject(std::move(str));
-        }
+    switch(this->state.load(std::memory_order_relaxed)) {
+        case SpecializationState::NUMBER:
+            if(value.isNumber()) {
+                Specialization::hit(SpecializedNode::NUMBER_UNARY);
+                return DynamicObject(this->op == UnaryOperator::NEGATE
+                                         ? -value.getNumber()
+                                         : value.getNumber());
+            }
+
+            this->state.store(SpecializationState::GENERIC,
+                              std::memory_order_relaxed);
+            Specialization::miss(SpecializedNode::NUMBER_UNARY);
+            break;
+
+        case SpecializationState::UNINITIALIZED:
+            if(value.isNumber() && (this->op == UnaryOperator::NEGATE ||
+                                    this->op == UnaryOperator::PLUS)) {
+                this->state.store(SpecializationState::NUMBER,
+                                  std::memory_order_relaxed);
+                Specialization::rewrite(SpecializedNode::NUMBER_UNARY);
+            } else
+                this->state.store(SpecializationState::GENERIC,
+                                  std::memory_order_relaxed);
+            break;
+
+        case SpecializationState::STRING:
+        case SpecializationState::GENERIC:
+        default:
+            break;
     }
 
-    throw ASTNodeException(std::move(this->address),
-                           "Invalid unary expression operation");
+    return UnaryExpression::applyOperator(this->address, this->op, value);
+}
+
+UnaryOperator UnaryExpression::resolveOperator(const std::string& image) {
+    if(image == "+")
+        return UnaryOperator::PLUS;
+    else if(image == "-")
+        return UnaryOperator::NEGATE;
+    else if(image == "!")
+        return UnaryOperator::NOT;
+    else if(image == "~")
+        return UnaryOperator::INVERT;
+    else if(image == "*")
+        return UnaryOperator::LENGTH;
+
+    throw std::invalid_argument("Unknown unary operator: " + image);
+}
+
+DynamicObject UnaryExpression::applyOperator(
+    const std::shared_ptr<Token>& address, UnaryOperator op,
+    const DynamicObject& value) {
+    switch(op) {
+        case UnaryOperator::NOT:
+            return DynamicObject(!value.booleanEquivalent());
+
+        case UnaryOperator::PLUS:
+            if(value.isNumber()) return DynamicObject(+value.getNumber());
+            break;
+
+        case UnaryOperator::NEGATE:
+            if(value.isNumber()) return DynamicObject(-value.getNumber());
+            break;
+
+        case UnaryOperator::INVERT:
+            if(value.isArray()) {
+                std::vector<DynamicObject> objects = *value.getArray();
+                std::reverse(objects.begin(), objects.end());
+
+                return DynamicObject(
+                    std::make_shared<std::vector<DynamicObject>>(objects));
+            } else if(value.isNumber())
+                return DynamicObject(static_cast<double>(
+                    ~static_cast<long>(value.getNumber())));
+            else if(value.isString()) {
+                std::string str = value.getString();
+                std::reverse(str.begin(), str.end());
+
+                return DynamicObject(std::move(str));
+            }
+            break;
+
+        case UnaryOperator::LENGTH:
+            if(value.isString())
+                return DynamicObject((double)value.getString().length());
+            break;
+
+        default:
+            break;
+    }
+
+    throw ASTNodeException(address, "Invalid unary expression operation");
+}
+
+void UnaryExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
 }
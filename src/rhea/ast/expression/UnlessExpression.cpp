@@ -18,6 +18,18 @@
 
 #include <rhea/ast/expression/UnlessExpression.hpp>
 
+const std::shared_ptr<ASTNode>& UnlessExpression::getCondition() const {
+    return this->condition;
+}
+
+const std::shared_ptr<ASTNode>& UnlessExpression::getThenBranch() const {
+    return this->thenBranch;
+}
+
+const std::shared_ptr<ASTNode>& UnlessExpression::getElseBranch() const {
+    return this->elseBranch;
+}
+
 DynamicObject UnlessExpression::visit(SymbolTable& symbols) {
     DynamicObject condValue = this->condition->visit(symbols);
 
@@ -28,3 +40,9 @@ DynamicObject UnlessExpression::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void UnlessExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->condition);
+    callback(this->thenBranch);
+    callback(this->elseBranch);
+}
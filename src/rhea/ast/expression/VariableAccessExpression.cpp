@@ -22,6 +22,18 @@ Token VariableAccessExpression::getName() const {
     return *this->name;
 }
 
+const std::shared_ptr<Token>& VariableAccessExpression::getNameToken() const {
+    return this->name;
+}
+
+const SymbolAddress& VariableAccessExpression::getSymbolAddress() const {
+    return this->symbolAddress;
+}
+
+void VariableAccessExpression::setSymbolAddress(SymbolAddress _symbolAddress) {
+    this->symbolAddress = _symbolAddress;
+}
+
 DynamicObject VariableAccessExpression::visit(SymbolTable& symbols) {
-    return symbols.getSymbol(std::move(this->address), this->name->getImage());
+    return symbols.getSymbol(this->name, this->symbolAddress);
 }
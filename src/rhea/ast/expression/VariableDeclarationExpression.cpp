@@ -20,9 +20,9 @@
 #include <filesystem>
 #include <rhea/ast/ASTNodeException.hpp>
 #include <rhea/ast/expression/VariableDeclarationExpression.hpp>
+#include <rhea/core/NativeBinding.hpp>
 #include <rhea/core/Runtime.hpp>
 #include <rhea/core/SymbolTable.hpp>
-#include <rhea/util/PathHelper.hpp>
 
 #if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
 #include <dlfcn.h>
@@ -32,86 +32,103 @@
 #error "Unsupported architecture for shared objects or dynamic libraries."
 #endif
 
+const std::map<Token,
+               std::pair<std::vector<std::string>, std::shared_ptr<ASTNode>>>&
+VariableDeclarationExpression::getDeclarations() const {
+    return this->declarations;
+}
+
+const std::string& VariableDeclarationExpression::getNativePath() const {
+    return this->nativePath;
+}
+
+const std::vector<SymbolAddress>&
+VariableDeclarationExpression::getSymbolAddresses() const {
+    return this->symbolAddresses;
+}
+
+void VariableDeclarationExpression::setSymbolAddresses(
+    std::vector<SymbolAddress> _symbolAddresses) {
+    this->symbolAddresses = std::move(_symbolAddresses);
+}
+
 DynamicObject VariableDeclarationExpression::visit(SymbolTable& symbols) {
+    size_t index = 0;
+
     if(!this->nativePath.empty()) {
-        for(const auto& [key, value] : this->declarations) {
-            std::string platform = "any";
+        std::string platform = "any", library;
 #if defined(__TERMUX__)
-            platform = "termux";
+        platform = "termux";
 #elif defined(__linux__)
-            platform = "linux";
+        platform = "linux";
 #elif defined(__APPLE__)
-            platform = "darwin";
+        platform = "darwin";
 #elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
-            platform = "windows";
+        platform = "windows";
 #endif
 
+        for(const auto& [key, value] : this->declarations) {
+            size_t current = index++;
+
             if(value.first.size() != 0) {
-                std::vector<std::string> platforms = value.first;
+                const std::vector<std::string>& platforms = value.first;
 
                 if(std::find(platforms.begin(), platforms.end(), platform) ==
                    platforms.end())
                     continue;
             }
 
-            std::string name = key.getImage();
-            DynamicObject func =
-                DynamicObject(VariableDeclarationExpression::loadNativeFunction(
-                    this->nativePath, name, std::move(this->address)));
+            if(library.empty())
+                library = VariableDeclarationExpression::loadLibrary(
+                    this->nativePath, this->address);
 
-            symbols.setSymbol(std::make_shared<Token>(key), std::move(func));
+            symbols.setSymbol(
+                this->names[current], this->symbolAddresses[current],
+                DynamicObject(NativeBinding::get(library, key.getImage())));
         }
 
         return {};
     }
 
-    for(const auto& [key, value] : this->declarations)
-        symbols.setSymbol(std::make_shared<Token>(key),
+    for(const auto& [key, value] : this->declarations) {
+        symbols.setSymbol(this->names[index], this->symbolAddresses[index],
                           value.second->visit(symbols));
+        index++;
+    }
 
     return {};
 }
 
-NativeFunction VariableDeclarationExpression::loadNativeFunction(
-    std::string& libName, std::string& funcName,
-    std::shared_ptr<Token> address) {
+std::string VariableDeclarationExpression::loadLibrary(
+    const std::string& libName, const std::shared_ptr<Token>& address) {
 #ifndef __EMSCRIPTEN__
 
-    void* handle;
-    std::string library =
-        RheaUtil::PathHelper::findSharedLibrary(std::string(libName.c_str()));
+    std::string library = NativeBinding::locate(libName);
+    if(Runtime::hasLoadedLibrary(library)) return library;
 
+    void* handle;
     std::filesystem::path searchPath(library);
-    if(Runtime::hasLoadedLibrary(library))
-#if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
-        handle = Runtime::getLoadedLibrary(library);
-#elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
-        handle = static_cast<HMODULE>(Runtime::getLoadedLibrary(library));
-#endif
-    else {
+
 #if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
 
-        AddDllDirectory(searchPath.parent_path().wstring().c_str());
-        handle = LoadLibraryA(library.c_str());
+    AddDllDirectory(searchPath.parent_path().wstring().c_str());
+    handle = LoadLibraryA(library.c_str());
 
 #elif defined(__APPLE__)
-        handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+    handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
 #elif defined(__unix__) || defined(__linux__)
-            dlerror();
-            handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
-
-            {
-                const char* dlErr = dlerror();
-                if(dlErr)
-                    throw ASTNodeException(
-                        std::move(address),
-                        "Failed to load library: " + library +
-                            "\r\n                 " + std::string(dlErr));
-            }
-#endif
-
-        Runtime::addLoadedLibrary(library, handle);
+    dlerror();
+    handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    {
+        const char* dlErr = dlerror();
+        if(dlErr)
+            throw ASTNodeException(address, "Failed to load library: " +
+                                                library +
+                                                "\r\n                 " +
+                                                std::string(dlErr));
     }
+#endif
 
     if(!handle) {
 #if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
@@ -129,50 +146,31 @@ NativeFunction VariableDeclarationExpression::loadNativeFunction(
 #endif
 
         throw ASTNodeException(
-            std::move(address), "Failed to load library: " + library +
-                                    "\r\n                 " +
+            address, "Failed to load library: " + library +
+                         "\r\n                 " +
 #if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
-                                    dlerror()
+                         dlerror()
 #elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
-                                    std::string(message)
+                         std::string(message)
 #endif
         );
     }
 
-    std::string name = funcName;
-    std::replace(name.begin(), name.end(), '.', '_');
-
-#if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
-
-    auto func = reinterpret_cast<NativeFunction>(dlsym(handle, name.c_str()));
-
-#elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
-
-    union FunctionCaster {
-        FARPROC proc;
-        NativeFunction func;
-    };
-
-    FunctionCaster caster;
-    caster.proc = GetProcAddress(static_cast<HMODULE>(handle), name.c_str());
-    auto func = caster.func;
-
-#endif
-
-    if(!func) {
-#if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
-        dlclose(handle);
-#elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
-        FreeLibrary((HMODULE)handle);
-#endif
+    Runtime::addLoadedLibrary(library, handle);
+    NativeBinding::link(library, handle);
 
-        throw std::runtime_error("Failed to find function: " + funcName);
-    }
-
-    return func;
+    return library;
 
 #else
+    (void)libName;
+    (void)address;
+
     throw std::runtime_error(
         "Loading native functions in web mode is not supported.");
 #endif
 }
+
+void VariableDeclarationExpression::forEachChild(
+    const ASTChildCallback& callback) {
+    for(auto& [key, value] : this->declarations) callback(value.second);
+}
@@ -18,6 +18,20 @@
 
 #include <rhea/ast/expression/WhenExpression.hpp>
 
+const std::shared_ptr<ASTNode>& WhenExpression::getExpression() const {
+    return this->expression;
+}
+
+const std::vector<
+    std::pair<std::shared_ptr<ASTNode>, std::shared_ptr<ASTNode>>>&
+WhenExpression::getCases() const {
+    return this->cases;
+}
+
+const std::shared_ptr<ASTNode>& WhenExpression::getDefaultCase() const {
+    return this->defaultCase;
+}
+
 DynamicObject WhenExpression::visit(SymbolTable& symbols) {
     DynamicObject expr = this->expression->visit(symbols);
     for(const auto& caseCell : this->cases)
@@ -28,3 +42,13 @@ DynamicObject WhenExpression::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void WhenExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+    for(auto& [condition, branch] : this->cases) {
+        callback(condition);
+        callback(branch);
+    }
+
+    callback(this->defaultCase);
+}
@@ -16,18 +16,34 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/expression/WhileExpression.hpp>
 
+const std::shared_ptr<ASTNode>& WhileExpression::getCondition() const {
+    return this->expression;
+}
+
+const std::shared_ptr<ASTNode>& WhileExpression::getBody() const {
+    return this->body;
+}
+
 DynamicObject WhileExpression::visit(SymbolTable& symbols) {
     DynamicObject value;
 
-    while(this->expression->visit(symbols).booleanEquivalent()) try {
-            value = this->body->visit(symbols);
-        } catch(const TerminativeBreakSignal& breakSig) {
-            break;
-        } catch(const TerminativeContinueSignal& continueSig) {
-            continue;
-        }
+    while(this->expression->visit(symbols).booleanEquivalent()) {
+        DynamicObject result = this->body->visit(symbols);
+
+        if(Completion::isAbrupt()) {
+            if(Completion::consume(CompletionType::BREAK)) break;
+            if(!Completion::consume(CompletionType::CONTINUE)) return result;
+        } else
+            value = std::move(result);
+    }
 
     return value;
 }
+
+void WhileExpression::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+    callback(this->body);
+}
@@ -16,9 +16,11 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/statement/BreakStatement.hpp>
 
 DynamicObject BreakStatement::visit(SymbolTable& symbols
                                     __attribute__((unused))) {
-    throw TerminativeBreakSignal(*this->address);
+    Completion::signal(CompletionType::BREAK, this->address);
+    return {};
 }
@@ -16,9 +16,11 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/statement/ContinueStatement.hpp>
 
 DynamicObject ContinueStatement::visit(SymbolTable& symbols
                                        __attribute__((unused))) {
-    throw TerminativeContinueSignal(*this->address);
+    Completion::signal(CompletionType::CONTINUE, this->address);
+    return {};
 }
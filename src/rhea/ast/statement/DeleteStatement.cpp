@@ -16,12 +16,10 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <Rhea.hpp>
 #include <rhea/ast/statement/DeleteStatement.hpp>
 
 DynamicObject DeleteStatement::visit(SymbolTable& symbols) {
-    parsync(const auto& variable
-            : this->variables) symbols.removeSymbol(variable);
+    for(const auto& variable : this->variables) symbols.removeSymbol(variable);
 
     return {};
 }
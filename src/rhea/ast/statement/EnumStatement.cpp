@@ -19,6 +19,15 @@
 #include <rhea/ast/statement/EnumStatement.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
+const std::shared_ptr<Token>& EnumStatement::getName() const {
+    return this->name;
+}
+
+const std::map<std::shared_ptr<Token>, std::shared_ptr<ASTNode>>&
+EnumStatement::getList() const {
+    return this->list;
+}
+
 DynamicObject EnumStatement::visit(SymbolTable& symbols) {
     for(const auto& pair : this->list) {
         Token itemName = *pair.first;
@@ -31,3 +40,7 @@ DynamicObject EnumStatement::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void EnumStatement::forEachChild(const ASTChildCallback& callback) {
+    for(auto& [key, value] : this->list) callback(value);
+}
@@ -18,6 +18,14 @@
 
 #include <rhea/ast/statement/ExpressionStatement.hpp>
 
+const std::shared_ptr<ASTNode>& ExpressionStatement::getExpression() const {
+    return this->expression;
+}
+
 DynamicObject ExpressionStatement::visit(SymbolTable& symbols) {
     return this->expression->visit(symbols);
 }
+
+void ExpressionStatement::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
@@ -19,6 +19,15 @@
 #include <rhea/ast/statement/ModStatement.hpp>
 #include <rhea/core/SymbolTable.hpp>
 
+const std::shared_ptr<Token>& ModStatement::getName() const {
+    return this->name;
+}
+
+const std::map<std::shared_ptr<Token>, std::shared_ptr<ASTNode>>&
+ModStatement::getMembers() const {
+    return this->members;
+}
+
 DynamicObject ModStatement::visit(SymbolTable& symbols) {
     for(const auto& pair : this->members) {
         Token itemName = *pair.first;
@@ -31,3 +40,7 @@ DynamicObject ModStatement::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void ModStatement::forEachChild(const ASTChildCallback& callback) {
+    for(auto& [key, value] : this->members) callback(value);
+}
@@ -16,8 +16,20 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/statement/ReturnStatement.hpp>
 
+const std::shared_ptr<ASTNode>& ReturnStatement::getExpression() const {
+    return this->expression;
+}
+
 DynamicObject ReturnStatement::visit(SymbolTable& symbols) {
-    throw TerminativeReturnSignal(this->expression->visit(symbols));
+    DynamicObject value = this->expression->visit(symbols);
+    Completion::signal(CompletionType::RETURN, this->address);
+
+    return value;
+}
+
+void ReturnStatement::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
 }
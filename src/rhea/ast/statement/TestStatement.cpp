@@ -23,6 +23,18 @@
 #include <rhea/core/SymbolTable.hpp>
 #include <rhea/util/Render.hpp>
 
+const std::shared_ptr<ASTNode>& TestStatement::getTestName() const {
+    return this->testName;
+}
+
+const std::shared_ptr<ASTNode>& TestStatement::getTestBody() const {
+    return this->testBody;
+}
+
+const std::shared_ptr<ASTNode>& TestStatement::getTestAssert() const {
+    return this->testAssert;
+}
+
 DynamicObject TestStatement::visit(SymbolTable& symbols) {
     if(!Runtime::isTestMode()) return {};
 
@@ -48,3 +60,9 @@ DynamicObject TestStatement::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void TestStatement::forEachChild(const ASTChildCallback& callback) {
+    callback(this->testName);
+    callback(this->testBody);
+    callback(this->testAssert);
+}
@@ -18,7 +18,15 @@
 
 #include <rhea/ast/statement/ThrowStatement.hpp>
 
+const std::shared_ptr<ASTNode>& ThrowStatement::getExpression() const {
+    return this->expression;
+}
+
 DynamicObject ThrowStatement::visit(SymbolTable& symbols) {
     throw TerminativeThrowSignal(std::move(this->address),
                                  this->expression->visit(symbols));
 }
+
+void ThrowStatement::forEachChild(const ASTChildCallback& callback) {
+    callback(this->expression);
+}
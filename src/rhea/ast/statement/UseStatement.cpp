@@ -22,6 +22,14 @@
 #include <rhea/util/PathHelper.hpp>
 #include <rhea/util/SemVer.hpp>
 
+const std::shared_ptr<ASTNode>& UseStatement::getLibraryName() const {
+    return this->libraryName;
+}
+
+const std::shared_ptr<ASTNode>& UseStatement::getLibraryVersion() const {
+    return this->libraryVersion;
+}
+
 DynamicObject UseStatement::visit(SymbolTable& symbols) {
 #ifndef __EMSCRIPTEN__
     DynamicObject libName = this->libraryName->visit(symbols),
@@ -55,3 +63,8 @@ DynamicObject UseStatement::visit(SymbolTable& symbols) {
 
     return {};
 }
+
+void UseStatement::forEachChild(const ASTChildCallback& callback) {
+    callback(this->libraryName);
+    callback(this->libraryVersion);
+}
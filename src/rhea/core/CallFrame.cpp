@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/core/CallFrame.hpp>
+
+thread_local std::vector<std::shared_ptr<SymbolTable>> CallFrame::pool;
+
+CallFrame::CallFrame(std::shared_ptr<const SymbolLayout> layout,
+                     std::shared_ptr<SymbolTable> parent)
+    : frame(nullptr) {
+    if(CallFrame::pool.empty()) {
+        this->frame =
+            std::make_shared<SymbolTable>(std::move(layout), std::move(parent));
+        return;
+    }
+
+    this->frame = std::move(CallFrame::pool.back());
+    CallFrame::pool.pop_back();
+    this->frame->reset(std::move(layout), std::move(parent));
+}
+
+CallFrame::~CallFrame() {
+    if(this->frame.use_count() != 1) return;
+
+    this->frame->reset(nullptr, nullptr);
+    CallFrame::pool.push_back(std::move(this->frame));
+}
+
+SymbolTable& CallFrame::operator*() const {
+    return *this->frame;
+}
+
+SymbolTable* CallFrame::operator->() const {
+    return this->frame.get();
+}
@@ -21,52 +21,82 @@
 #include <rhea/ast/ASTNodeException.hpp>
 #include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
 #include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/HandleTable.hpp>
+#include <rhea/core/NativeBinding.hpp>
 #include <rhea/core/RegexWrapper.hpp>
 #include <rhea/core/SymbolTable.hpp>
+#include <rhea/core/Task.hpp>
 #include <rhea/util/VectorMath.hpp>
 #include <string>
 
+void DynamicObject::retainHandle(uint64_t handle) {
+    HandleTable::retain(handle);
+}
+
+void DynamicObject::release() {
+    switch(this->type) {
+        case DynamicObjectType::STRING:
+            DynamicObject::drop<std::string>(this->payload.cell);
+            break;
+
+        case DynamicObjectType::ARRAY:
+            DynamicObject::drop<std::shared_ptr<std::vector<DynamicObject>>>(
+                this->payload.cell);
+            break;
+
+        case DynamicObjectType::REGEX:
+            DynamicObject::drop<std::shared_ptr<RegexWrapper>>(
+                this->payload.cell);
+            break;
+
+        case DynamicObjectType::FUNCTION:
+            DynamicObject::drop<
+                std::shared_ptr<FunctionDeclarationExpression>>(
+                this->payload.cell);
+            break;
+
+        case DynamicObjectType::FUTURE:
+            DynamicObject::drop<std::shared_ptr<Task>>(this->payload.cell);
+            break;
+
+        case DynamicObjectType::HANDLE:
+            HandleTable::release(this->payload.handle);
+            break;
+
+        case DynamicObjectType::NIL:
+        case DynamicObjectType::NUMBER:
+        case DynamicObjectType::BOOL:
+        case DynamicObjectType::NATIVE:
+        default:
+            break;
+    }
+}
+
 DynamicObject& DynamicObject::operator=(const DynamicObject& other) {
     if(this != &other) {
-        if(this->isLocked) return *this;
+        other.retain();
+        if(this->isCounted()) this->release();
 
         this->type = other.type;
-        this->isLocked = other.isLocked;
-        this->owner = other.owner;
-
-        this->numberValue = other.numberValue;
-        this->boolValue = other.boolValue;
-        this->stringValue = other.stringValue;
-
-        this->arrayValue = other.arrayValue;
-        this->functionValue = other.functionValue;
-        this->regexValue = other.regexValue;
-        this->nativeValue = other.nativeValue;
+        this->payload = other.payload;
     }
 
     return *this;
 }
 
-DynamicObject& DynamicObject::operator=(DynamicObject&& other) {
+DynamicObject& DynamicObject::operator=(DynamicObject&& other) noexcept {
     if(this != &other) {
-        if(this->isLocked) return *this;
-
-        this->type = std::move(other.type);
-        this->isLocked = std::move(other.isLocked);
-        this->owner = std::move(other.owner);
-        this->arrayValue = std::move(other.arrayValue);
-        this->numberValue = std::move(other.numberValue);
-        this->stringValue = std::move(other.stringValue);
-        this->boolValue = std::move(other.boolValue);
-        this->functionValue = std::move(other.functionValue);
-        this->regexValue = std::move(other.regexValue);
-        this->nativeValue = std::move(other.nativeValue);
+        if(this->isCounted()) this->release();
+
+        this->type = other.type;
+        this->payload = other.payload;
+        other.type = DynamicObjectType::NIL;
     }
 
     return *this;
 }
 
-bool DynamicObject::operator==(const DynamicObject& other) {
+bool DynamicObject::operator==(const DynamicObject& other) const {
     if(this->isNil() && other.isNil())
         return true;
     else if((this->isNil() && !other.isNil()) ||
@@ -84,6 +114,10 @@ bool DynamicObject::operator==(const DynamicObject& other) {
     else if(this->isFunction() && other.isFunction())
         return this->getCallable()->getFunctionImage() ==
                other.getCallable()->getFunctionImage();
+    else if(this->isFuture() && other.isFuture())
+        return this->getFuture() == other.getFuture();
+    else if(this->isHandle() && other.isHandle())
+        return this->getHandle() == other.getHandle();
     else if(this->isArray() && other.isArray()) {
         size_t len = this->getArray()->size();
         if(len != other.getArray()->size()) return false;
@@ -99,7 +133,7 @@ bool DynamicObject::operator==(const DynamicObject& other) {
     return false;
 }
 
-bool DynamicObject::operator!=(const DynamicObject& other) {
+bool DynamicObject::operator!=(const DynamicObject& other) const {
     return !(*this == other);
 }
 
@@ -127,6 +161,14 @@ bool DynamicObject::isFunction() const {
     return this->type == DynamicObjectType::FUNCTION;
 }
 
+bool DynamicObject::isFuture() const {
+    return this->type == DynamicObjectType::FUTURE;
+}
+
+bool DynamicObject::isHandle() const {
+    return this->type == DynamicObjectType::HANDLE;
+}
+
 bool DynamicObject::isNil() const {
     return this->type == DynamicObjectType::NIL;
 }
@@ -136,40 +178,58 @@ bool DynamicObject::isRegex() const {
 }
 
 double DynamicObject::getNumber() const {
-    return this->numberValue;
+    return this->isNumber() ? this->payload.number : 0.0;
 }
 
 const std::string& DynamicObject::getString() const {
-    return this->stringValue;
+    static const std::string empty;
+    return this->isString() ? this->cell<std::string>() : empty;
 }
 
 bool DynamicObject::getBool() const {
-    return this->boolValue;
+    return this->isBool() && this->payload.boolean;
 }
 
 std::shared_ptr<FunctionDeclarationExpression> DynamicObject::getCallable()
     const {
-    return this->functionValue;
+    if(!this->isFunction()) return nullptr;
+    return this->cell<std::shared_ptr<FunctionDeclarationExpression>>();
 }
 
 std::shared_ptr<RegexWrapper> DynamicObject::getRegex() const {
-    return this->regexValue;
+    if(!this->isRegex()) return nullptr;
+    return this->cell<std::shared_ptr<RegexWrapper>>();
+}
+
+std::shared_ptr<Task> DynamicObject::getFuture() const {
+    if(!this->isFuture()) return nullptr;
+    return this->cell<std::shared_ptr<Task>>();
 }
 
 std::shared_ptr<std::vector<DynamicObject>> DynamicObject::getArray() const {
-    return this->arrayValue;
+    if(!this->isArray()) return nullptr;
+    return this->cell<std::shared_ptr<std::vector<DynamicObject>>>();
 }
 
 NativeFunction DynamicObject::getNativeFunction() const {
-    return this->nativeValue;
+    return this->isNative() ? this->payload.native->resolve() : nullptr;
+}
+
+NativeBinding* DynamicObject::getNativeBinding() const {
+    return this->isNative() ? this->payload.native : nullptr;
 }
 
-bool DynamicObject::booleanEquivalent() {
+uint64_t DynamicObject::getHandle() const {
+    return this->isHandle() ? this->payload.handle : 0;
+}
+
+bool DynamicObject::booleanEquivalent() const {
     return (this->isBool() && this->getBool()) ||
            (this->isNumber() && this->getNumber() < 0.0) ||
            (this->isString() && !this->getString().empty()) ||
            (this->isArray() && this->getArray()->size()) ||
-           this->isFunction() || this->isRegex() || this->isNative();
+           this->isFunction() || this->isRegex() || this->isNative() ||
+           this->isFuture() || this->isHandle();
 }
 
 void DynamicObject::setArrayElement(std::shared_ptr<Token> reference,
@@ -179,10 +239,11 @@ void DynamicObject::setArrayElement(std::shared_ptr<Token> reference,
         throw ASTNodeException(std::move(reference),
                                "Subject value not an array.");
 
-    if(index >= this->arrayValue->size())
+    auto& array = this->cell<std::shared_ptr<std::vector<DynamicObject>>>();
+    if(index >= array->size())
         throw ASTNodeException(std::move(reference), "Index is out of bounds.");
 
-    (*this->arrayValue)[index] = std::move(*object);
+    (*array)[index] = std::move(*object);
 }
 
 DynamicObject DynamicObject::callFromNative(std::shared_ptr<Token> address,
@@ -192,33 +253,14 @@ DynamicObject DynamicObject::callFromNative(std::shared_ptr<Token> address,
         throw ASTNodeException(std::move(address),
                                "Cannot call non-callable object");
 
-    return !this->isNative()
-               ? this->getCallable()->call(symtab, args)
-               : this->getNativeFunction()(std::move(address), symtab, args,
-                                           Runtime::isUnsafeMode());
-}
-
-void DynamicObject::lock() {
-    this->isLocked = true;
-}
-
-void DynamicObject::unlock() {
-    this->isLocked = false;
-}
-
-bool DynamicObject::hasLock() {
-    return this->isLocked;
-}
-
-std::string DynamicObject::ownerId() const {
-    return this->owner;
-}
+    if(!this->isNative()) return this->getCallable()->call(symtab, args);
 
-void DynamicObject::own(std::string ownerUuid) {
-    this->owner = ownerUuid;
+    this->payload.native->expect(address, args.size());
+    return this->getNativeFunction()(std::move(address), symtab, args,
+                                     Runtime::isUnsafeMode());
 }
 
-std::string DynamicObject::objectType() {
+std::string DynamicObject::objectType() const {
     if(this->isArray())
         return "array";
     else if(this->isBool())
@@ -235,11 +277,15 @@ std::string DynamicObject::objectType() {
         return "regex";
     else if(this->isNative())
         return "native";
+    else if(this->isFuture())
+        return "future";
+    else if(this->isHandle())
+        return "handle";
 
     return "unknown";
 }
 
-std::string DynamicObject::toString() {
+std::string DynamicObject::toString() const {
     if(this->isNil())
         return "nil";
     else if(this->isNumber()) {
@@ -258,7 +304,7 @@ std::string DynamicObject::toString() {
     else if(this->isBool())
         return (this->getBool() ? "true" : "false");
     else if(this->isRegex())
-        return this->regexValue->getPattern();
+        return this->getRegex()->getPattern();
     else if(this->isFunction()) {
         const auto& functionImage = this->getCallable()->getFunctionImage();
         return "<func [" + std::to_string(functionImage.getLine()) + ", " +
@@ -310,11 +356,17 @@ std::string DynamicObject::toString() {
         return result;
     } else if(this->isNative())
         return "{{native_func}}";
+    else if(this->isFuture())
+        return this->getFuture()->isFinished() ? "{{future_done}}"
+                                               : "{{future_pending}}";
+    else if(this->isHandle())
+        return HandleTable::describe(this->payload.handle);
 
     return "{untyped}";
 }
 
-DynamicObject operator+(DynamicObject left, DynamicObject right) {
+DynamicObject operator+(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(left.getNumber() + right.getNumber());
     else if(left.isNumber() && right.isString())
@@ -324,6 +376,7 @@ DynamicObject operator+(DynamicObject left, DynamicObject right) {
             (left.isRegex() && right.isArray()) ||
             (left.isBool() && right.isArray()) ||
             (left.isFunction() && right.isArray()) ||
+            (left.isHandle() && right.isArray()) ||
             (left.isNil() && right.isArray())) {
         std::shared_ptr<std::vector<DynamicObject>> array = right.getArray();
 
@@ -334,6 +387,7 @@ DynamicObject operator+(DynamicObject left, DynamicObject right) {
             std::string(std::to_string(left.getNumber())) + right.toString()));
     else if((left.isString() && right.isNumber()) ||
             (left.isString() && right.isBool()) ||
+            (left.isString() && right.isHandle()) ||
             (left.isString() && right.isString()))
         return DynamicObject(left.toString() + right.toString());
     else if(left.isString() && right.isRegex())
@@ -351,8 +405,9 @@ DynamicObject operator+(DynamicObject left, DynamicObject right) {
             "Add operation for two (2) arrays cannot be done; "
             "not all elements are of number type.");
     } else if(left.isArray() &&
-              (right.isBool() || right.isFunction() || right.isNil() ||
-               right.isNumber() || right.isRegex() || right.isString())) {
+              (right.isBool() || right.isFunction() || right.isHandle() ||
+               right.isNil() || right.isNumber() || right.isRegex() ||
+               right.isString())) {
         std::shared_ptr<std::vector<DynamicObject>> array = left.getArray();
 
         array->emplace_back(right);
@@ -388,7 +443,8 @@ DynamicObject operator+(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator-(DynamicObject left, DynamicObject right) {
+DynamicObject operator-(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNil())
         return right;
     else if(right.isNil())
@@ -438,7 +494,8 @@ DynamicObject operator-(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator/(DynamicObject left, DynamicObject right) {
+DynamicObject operator/(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber()) {
         if(std::abs(right.getNumber()) < 1e-15)
             throw std::runtime_error("Division by zero.");
@@ -475,7 +532,8 @@ DynamicObject operator/(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator*(DynamicObject left, DynamicObject right) {
+DynamicObject operator*(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(left.getNumber() * right.getNumber());
     else if(left.isNumber() && right.isBool())
@@ -526,7 +584,8 @@ DynamicObject operator*(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator%(DynamicObject left, DynamicObject right) {
+DynamicObject operator%(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber()) {
         long rhs = static_cast<long>(right.getNumber());
         if(rhs == 0) throw std::runtime_error("Modulo by zero.");
@@ -566,7 +625,8 @@ DynamicObject operator%(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator<(DynamicObject left, DynamicObject right) {
+DynamicObject operator<(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(left.getNumber() < right.getNumber());
     else if(left.isNumber() && right.isBool())
@@ -589,7 +649,8 @@ DynamicObject operator<(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator>(DynamicObject left, DynamicObject right) {
+DynamicObject operator>(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(left.getNumber() > right.getNumber());
     else if(left.isNumber() && right.isBool())
@@ -612,7 +673,8 @@ DynamicObject operator>(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator<=(DynamicObject left, DynamicObject right) {
+DynamicObject operator<=(const DynamicObject& left,
+                         const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(left.getNumber() <= right.getNumber());
     else if(left.isNumber() && right.isBool())
@@ -635,7 +697,8 @@ DynamicObject operator<=(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator>=(DynamicObject left, DynamicObject right) {
+DynamicObject operator>=(const DynamicObject& left,
+                         const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(left.getNumber() >= right.getNumber());
     else if(left.isNumber() && right.isBool())
@@ -658,7 +721,8 @@ DynamicObject operator>=(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator<<(DynamicObject left, DynamicObject right) {
+DynamicObject operator<<(const DynamicObject& left,
+                         const DynamicObject& right) {
     auto guardShift = [](long shift) {
         if(shift < 0 || shift >= static_cast<long>(sizeof(long) * 8))
             throw std::runtime_error("Shift amount out of range: " +
@@ -703,7 +767,8 @@ DynamicObject operator<<(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator>>(DynamicObject left, DynamicObject right) {
+DynamicObject operator>>(const DynamicObject& left,
+                         const DynamicObject& right) {
     auto guardShift = [](long shift) {
         if(shift < 0 || shift >= static_cast<long>(sizeof(long) * 8))
             throw std::runtime_error("Shift amount out of range: " +
@@ -748,7 +813,8 @@ DynamicObject operator>>(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator&(DynamicObject left, DynamicObject right) {
+DynamicObject operator&(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(
             static_cast<double>(static_cast<long>(left.getNumber()) &
@@ -782,7 +848,8 @@ DynamicObject operator&(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator|(DynamicObject left, DynamicObject right) {
+DynamicObject operator|(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(
             static_cast<double>(static_cast<long>(left.getNumber()) |
@@ -817,7 +884,8 @@ DynamicObject operator|(DynamicObject left, DynamicObject right) {
                              left.objectType() + " and " + right.objectType());
 }
 
-DynamicObject operator^(DynamicObject left, DynamicObject right) {
+DynamicObject operator^(const DynamicObject& left,
+                        const DynamicObject& right) {
     if(left.isNumber() && right.isNumber())
         return DynamicObject(
             static_cast<double>(static_cast<long>(left.getNumber()) ^
@@ -855,17 +923,19 @@ DynamicObject operator^(DynamicObject left, DynamicObject right) {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Weffc++"
 
-DynamicObject operator&&(DynamicObject left, DynamicObject right) {
+DynamicObject operator&&(const DynamicObject& left,
+                         const DynamicObject& right) {
     return DynamicObject(left.booleanEquivalent() && right.booleanEquivalent());
 }
 
-DynamicObject operator||(DynamicObject left, DynamicObject right) {
+DynamicObject operator||(const DynamicObject& left,
+                         const DynamicObject& right) {
     return DynamicObject(left.booleanEquivalent() || right.booleanEquivalent());
 }
 
 #pragma GCC diagnostic pop
 
-DynamicObject DynamicObject::vectorAdd(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorAdd(const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -880,7 +950,7 @@ DynamicObject DynamicObject::vectorAdd(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorSub(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorSub(const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -895,7 +965,7 @@ DynamicObject DynamicObject::vectorSub(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorDiv(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorDiv(const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -910,7 +980,7 @@ DynamicObject DynamicObject::vectorDiv(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorMul(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorMul(const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -925,7 +995,7 @@ DynamicObject DynamicObject::vectorMul(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorRem(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorRem(const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -940,7 +1010,8 @@ DynamicObject DynamicObject::vectorRem(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorBitwiseAnd(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorBitwiseAnd(
+    const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -955,7 +1026,8 @@ DynamicObject DynamicObject::vectorBitwiseAnd(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorBitwiseOr(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorBitwiseOr(
+    const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -970,7 +1042,8 @@ DynamicObject DynamicObject::vectorBitwiseOr(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorBitwiseXor(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorBitwiseXor(
+    const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -985,7 +1058,8 @@ DynamicObject DynamicObject::vectorBitwiseXor(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorShiftLeft(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorShiftLeft(
+    const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -1000,7 +1074,8 @@ DynamicObject DynamicObject::vectorShiftLeft(DynamicObject arrayVal) {
             this->getNumber(), RheaUtil::object2Vector(arrayVal))));
 }
 
-DynamicObject DynamicObject::vectorShiftRight(DynamicObject arrayVal) {
+DynamicObject DynamicObject::vectorShiftRight(
+    const DynamicObject& arrayVal) const {
     if(!arrayVal.isArray())
         throw std::runtime_error("Object value is not of array type.");
     else if(!this->isNumber())
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/core/HandleTable.hpp>
+#include <stdexcept>
+
+std::atomic<HandleTable::Slot*>
+    HandleTable::segments[HandleTable::segmentCount] = {};
+std::atomic<uint64_t> HandleTable::freeList(0);
+std::atomic<uint32_t> HandleTable::used(0);
+std::mutex HandleTable::growth;
+
+// The free list head packs a counter above the index of the first free
+// slot (plus one, so zero means empty). Bumping the counter on every
+// change keeps a stale head from winning the swap after the slot was
+// popped and pushed back in between.
+static constexpr uint64_t indexMask = UINT64_C(0xFFFFFFFF);
+
+HandleTable::Slot* HandleTable::slotAt(uint32_t index) {
+    Slot* segment = HandleTable::segments[index / HandleTable::segmentSize]
+                        .load(std::memory_order_acquire);
+
+    return segment == nullptr ? nullptr
+                              : &segment[index % HandleTable::segmentSize];
+}
+
+HandleTable::Slot* HandleTable::slotFor(uint64_t id) {
+    uint32_t index = static_cast<uint32_t>(id & indexMask);
+    if(index >= HandleTable::used.load(std::memory_order_acquire))
+        return nullptr;
+
+    Slot* slot = HandleTable::slotAt(index);
+    if(slot == nullptr ||
+       slot->generation.load(std::memory_order_acquire) !=
+           static_cast<uint32_t>(id >> 32))
+        return nullptr;
+
+    return slot;
+}
+
+uint32_t HandleTable::acquire() {
+    uint64_t head = HandleTable::freeList.load(std::memory_order_acquire);
+
+    while((head & indexMask) != 0) {
+        uint32_t index = static_cast<uint32_t>(head & indexMask) - 1;
+        uint64_t next = HandleTable::slotAt(index)->next.load(
+            std::memory_order_relaxed);
+
+        if(HandleTable::freeList.compare_exchange_weak(
+               head, (((head >> 32) + 1) << 32) | next,
+               std::memory_order_acq_rel, std::memory_order_acquire))
+            return index;
+    }
+
+    uint32_t index = HandleTable::used.load(std::memory_order_relaxed);
+    do {
+        if(index >= HandleTable::segmentSize * HandleTable::segmentCount)
+            throw std::runtime_error("Too many native handles are open.");
+    } while(!HandleTable::used.compare_exchange_weak(
+        index, index + 1, std::memory_order_acq_rel,
+        std::memory_order_relaxed));
+
+    std::atomic<Slot*>& segment =
+        HandleTable::segments[index / HandleTable::segmentSize];
+
+    if(segment.load(std::memory_order_acquire) == nullptr) {
+        std::lock_guard<std::mutex> lock(HandleTable::growth);
+
+        if(segment.load(std::memory_order_relaxed) == nullptr)
+            segment.store(new Slot[HandleTable::segmentSize],
+                          std::memory_order_release);
+    }
+
+    return index;
+}
+
+void HandleTable::recycle(uint32_t index) {
+    Slot* slot = HandleTable::slotAt(index);
+    uint64_t head = HandleTable::freeList.load(std::memory_order_relaxed);
+
+    do {
+        slot->next.store(static_cast<uint32_t>(head & indexMask),
+                         std::memory_order_relaxed);
+    } while(!HandleTable::freeList.compare_exchange_weak(
+        head, (((head >> 32) + 1) << 32) | (static_cast<uint64_t>(index) + 1),
+        std::memory_order_release, std::memory_order_relaxed));
+}
+
+DynamicObject HandleTable::create(const HandleKind& kind, void* object) {
+    uint32_t index = HandleTable::acquire();
+    Slot* slot = HandleTable::slotAt(index);
+
+    slot->kind.store(&kind, std::memory_order_relaxed);
+    slot->object.store(object, std::memory_order_relaxed);
+    slot->open.store(true, std::memory_order_relaxed);
+    slot->references.store(1, std::memory_order_release);
+
+    return DynamicObject(
+        DynamicObjectType::HANDLE,
+        (static_cast<uint64_t>(
+             slot->generation.load(std::memory_order_relaxed))
+         << 32) |
+        index);
+}
+
+void* HandleTable::find(const DynamicObject& handle, const HandleKind& kind) {
+    if(!handle.isHandle()) return nullptr;
+
+    Slot* slot = HandleTable::slotFor(handle.getHandle());
+    if(slot == nullptr || slot->kind.load(std::memory_order_acquire) != &kind ||
+       !slot->open.load(std::memory_order_acquire))
+        return nullptr;
+
+    return slot->object.load(std::memory_order_acquire);
+}
+
+void* HandleTable::take(const DynamicObject& handle, const HandleKind& kind) {
+    if(!handle.isHandle()) return nullptr;
+
+    Slot* slot = HandleTable::slotFor(handle.getHandle());
+    if(slot == nullptr || slot->kind.load(std::memory_order_acquire) != &kind ||
+       !slot->open.exchange(false, std::memory_order_acq_rel))
+        return nullptr;
+
+    return slot->object.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+// Unlike take, the object stays with the slot: calls that resolved the
+// handle before it closed may still be using it, and each of them holds a
+// reference, so the object is destroyed once the last one is released.
+void* HandleTable::close(const DynamicObject& handle, const HandleKind& kind) {
+    if(!handle.isHandle()) return nullptr;
+
+    Slot* slot = HandleTable::slotFor(handle.getHandle());
+    if(slot == nullptr || slot->kind.load(std::memory_order_acquire) != &kind ||
+       !slot->open.exchange(false, std::memory_order_acq_rel))
+        return nullptr;
+
+    return slot->object.load(std::memory_order_acquire);
+}
+
+void HandleTable::retain(uint64_t id) {
+    HandleTable::slotAt(static_cast<uint32_t>(id & indexMask))
+        ->references.fetch_add(1, std::memory_order_relaxed);
+}
+
+void HandleTable::release(uint64_t id) {
+    uint32_t index = static_cast<uint32_t>(id & indexMask);
+    Slot* slot = HandleTable::slotAt(index);
+
+    if(slot->references.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    const HandleKind* kind = slot->kind.load(std::memory_order_acquire);
+    void* object = slot->object.exchange(nullptr, std::memory_order_acq_rel);
+
+    if(object != nullptr && kind->destroy != nullptr) kind->destroy(object);
+
+    slot->kind.store(nullptr, std::memory_order_relaxed);
+    slot->generation.fetch_add(1, std::memory_order_release);
+    HandleTable::recycle(index);
+}
+
+std::string HandleTable::describe(uint64_t id) {
+    Slot* slot = HandleTable::slotFor(id);
+    const HandleKind* kind =
+        slot == nullptr ? nullptr : slot->kind.load(std::memory_order_acquire);
+
+    if(kind == nullptr) return "{{handle}}";
+
+    std::string result = "{{" + std::string(kind->name) + "#" +
+                         std::to_string(id & indexMask);
+    if(!slot->open.load(std::memory_order_acquire) ||
+       slot->object.load(std::memory_order_acquire) == nullptr)
+        result += " closed";
+
+    return result + "}}";
+}
+
+// Destroys every object still open. Runs before native libraries are
+// unloaded, since the destroy hooks live in them; handles released later
+// find their slot already closed.
+void HandleTable::closeAll() {
+    uint32_t count = HandleTable::used.load(std::memory_order_acquire);
+
+    for(uint32_t index = 0; index < count; index++) {
+        Slot* slot = HandleTable::slotAt(index);
+        if(slot == nullptr) continue;
+
+        const HandleKind* kind = slot->kind.load(std::memory_order_acquire);
+        void* object =
+            slot->object.exchange(nullptr, std::memory_order_acq_rel);
+        slot->open.store(false, std::memory_order_release);
+
+        if(object != nullptr && kind != nullptr && kind->destroy != nullptr)
+            kind->destroy(object);
+    }
+}
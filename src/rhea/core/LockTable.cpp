@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/core/LockTable.hpp>
+#include <rhea/core/Task.hpp>
+#include <rhea/util/Render.hpp>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+LockTable::Stripe LockTable::stripes[LockTable::stripeCount];
+
+class HeldLock final {
+   public:
+    const void* scope;
+    uint32_t slot;
+    const void* owner;
+    LockMode mode;
+};
+
+// Locks taken on this thread, each with the task (or thread) that took it.
+// A task run inline while another one waits has its own entries.
+static thread_local std::vector<HeldLock> held;
+
+static void relax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+LockTable::Stripe& LockTable::stripeFor(const void* scope, uint32_t slot) {
+    uint64_t key =
+        (static_cast<uint64_t>(reinterpret_cast<uintptr_t>(scope)) >> 4) ^
+        (static_cast<uint64_t>(slot) * UINT64_C(0x9E3779B97F4A7C15));
+
+    key ^= key >> 32;
+    return LockTable::stripes[static_cast<size_t>(key & (stripeCount - 1))];
+}
+
+const void* LockTable::owner() {
+    static thread_local const char thread = 0;
+    const Task* task = Task::getCurrent();
+
+    return task != nullptr ? static_cast<const void*>(task) : &thread;
+}
+
+bool LockTable::holds(const void* scope, uint32_t slot, LockMode mode) {
+    const void* self = LockTable::owner();
+    for(const auto& entry : held)
+        if(entry.scope == scope && entry.slot == slot &&
+           entry.owner == self &&
+           (mode == LockMode::READ || entry.mode == LockMode::WRITE))
+            return true;
+
+    return false;
+}
+
+LockTable::Entry* LockTable::find(Stripe& stripe, const void* scope,
+                                  uint32_t slot) {
+    for(auto& entry : stripe.entries)
+        if(entry.scope == scope && entry.slot == slot) return &entry;
+
+    return nullptr;
+}
+
+// Callers hold the stripe's mutex.
+bool LockTable::tryAcquire(Stripe& stripe, const void* scope, uint32_t slot,
+                           LockMode mode) {
+    Entry* entry = LockTable::find(stripe, scope, slot);
+
+    if(entry == nullptr) {
+        stripe.entries.push_back({scope, slot, 0, 0, false});
+        stripe.active.store(static_cast<uint32_t>(stripe.entries.size()),
+                            std::memory_order_release);
+        entry = &stripe.entries.back();
+    }
+
+    if(entry->writing) return false;
+
+    // A parked writer holds new readers back so they cannot starve it.
+    if(mode == LockMode::WRITE) {
+        if(entry->readers != 0) return false;
+        entry->writing = true;
+    } else {
+        if(entry->writersParked != 0) return false;
+        entry->readers++;
+    }
+
+    return true;
+}
+
+void LockTable::acquire(Stripe& stripe, const void* scope, uint32_t slot,
+                        LockMode mode) {
+    static const bool spinning = std::thread::hardware_concurrency() > 1;
+    std::atomic<uint64_t>& count =
+        mode == LockMode::WRITE ? stripe.writes : stripe.reads;
+
+    count.fetch_add(1, std::memory_order_relaxed);
+    std::unique_lock<std::mutex> lock(stripe.mtx);
+    if(LockTable::tryAcquire(stripe, scope, slot, mode)) return;
+
+    stripe.contended.fetch_add(1, std::memory_order_relaxed);
+
+    // Spin for about as long as it took to get the lock last time, so
+    // short critical sections never park and long ones stop burning CPU.
+    // The stripe is only retried after something in it was released.
+    uint32_t limit = stripe.spinLimit.load(std::memory_order_relaxed);
+    if(spinning) {
+        uint32_t seen = stripe.releases.load(std::memory_order_relaxed);
+        lock.unlock();
+
+        for(uint32_t i = 0; i < limit * 2; i++) {
+            relax();
+            if(stripe.releases.load(std::memory_order_acquire) == seen)
+                continue;
+
+            lock.lock();
+            if(LockTable::tryAcquire(stripe, scope, slot, mode)) {
+                stripe.spinLimit.store(limit + (i / 8) - (limit / 8) + 1,
+                                       std::memory_order_relaxed);
+                return;
+            }
+
+            seen = stripe.releases.load(std::memory_order_relaxed);
+            lock.unlock();
+        }
+
+        lock.lock();
+        if(LockTable::tryAcquire(stripe, scope, slot, mode)) return;
+    }
+
+    stripe.spinLimit.store(limit > 8 ? limit - limit / 8 : 8,
+                           std::memory_order_relaxed);
+    stripe.parked.fetch_add(1, std::memory_order_relaxed);
+    stripe.waiters++;
+
+    // The failed attempt leaves the entry in place, and a parked writer
+    // keeps it there until the writer gets its turn.
+    if(mode == LockMode::WRITE)
+        LockTable::find(stripe, scope, slot)->writersParked++;
+
+    stripe.released.wait(lock, [&]() {
+        if(mode == LockMode::WRITE)
+            LockTable::find(stripe, scope, slot)->writersParked--;
+
+        if(LockTable::tryAcquire(stripe, scope, slot, mode)) return true;
+        if(mode == LockMode::WRITE)
+            LockTable::find(stripe, scope, slot)->writersParked++;
+
+        return false;
+    });
+
+    stripe.waiters--;
+}
+
+void LockTable::release(Stripe& stripe, const void* scope, uint32_t slot,
+                        LockMode mode) {
+    std::lock_guard<std::mutex> lock(stripe.mtx);
+    Entry* entry = LockTable::find(stripe, scope, slot);
+
+    if(mode == LockMode::WRITE)
+        entry->writing = false;
+    else
+        entry->readers--;
+
+    if(!entry->writing && entry->readers == 0 && entry->writersParked == 0) {
+        *entry = stripe.entries.back();
+        stripe.entries.pop_back();
+        stripe.active.store(static_cast<uint32_t>(stripe.entries.size()),
+                            std::memory_order_release);
+    }
+
+    stripe.releases.fetch_add(1, std::memory_order_release);
+    if(stripe.waiters != 0) stripe.released.notify_all();
+}
+
+LockTable::Guard::Guard(const void* _scope, uint32_t _slot, LockMode _mode)
+    : scope(_scope), slot(_slot), mode(_mode), taken(false) {
+    if(this->scope == nullptr ||
+       LockTable::holds(this->scope, this->slot, LockMode::READ))
+        return;
+
+    LockTable::acquire(LockTable::stripeFor(this->scope, this->slot),
+                       this->scope, this->slot, this->mode);
+    held.push_back({this->scope, this->slot, LockTable::owner(), this->mode});
+    this->taken = true;
+}
+
+LockTable::Guard::~Guard() {
+    if(!this->taken) return;
+
+    const void* self = LockTable::owner();
+    for(auto entry = held.rbegin(); entry != held.rend(); ++entry)
+        if(entry->scope == this->scope && entry->slot == this->slot &&
+           entry->owner == self) {
+            held.erase(std::next(entry).base());
+            break;
+        }
+
+    LockTable::release(LockTable::stripeFor(this->scope, this->slot),
+                       this->scope, this->slot, this->mode);
+}
+
+bool LockTable::isReading(const void* scope, uint32_t slot) {
+    return LockTable::holds(scope, slot, LockMode::READ) &&
+           !LockTable::holds(scope, slot, LockMode::WRITE);
+}
+
+bool LockTable::isHolding() {
+    return !held.empty();
+}
+
+bool LockTable::awaitWritable(const void* scope, uint32_t slot) {
+    Stripe& stripe = LockTable::stripeFor(scope, slot);
+    if(stripe.active.load(std::memory_order_acquire) == 0 ||
+       LockTable::holds(scope, slot, LockMode::WRITE))
+        return true;
+
+    // Other readers rely on the value staying put while they hold it.
+    if(LockTable::holds(scope, slot, LockMode::READ)) return false;
+
+    std::unique_lock<std::mutex> lock(stripe.mtx);
+    if(LockTable::find(stripe, scope, slot) == nullptr) return true;
+
+    stripe.waiters++;
+    stripe.released.wait(lock, [&]() {
+        const Entry* entry = LockTable::find(stripe, scope, slot);
+        return entry == nullptr || (!entry->writing && entry->readers == 0);
+    });
+    stripe.waiters--;
+
+    return true;
+}
+
+void LockTable::report() {
+    uint64_t reads = 0, writes = 0, contended = 0, parked = 0;
+    size_t used = 0;
+
+    for(const Stripe& stripe : LockTable::stripes) {
+        uint64_t taken = stripe.reads.load() + stripe.writes.load();
+        if(taken == 0) continue;
+
+        used++;
+        reads += stripe.reads.load();
+        writes += stripe.writes.load();
+        contended += stripe.contended.load();
+        parked += stripe.parked.load();
+    }
+
+    RheaUtil::renderError(
+        "Locks: " + std::to_string(reads) + " read, " +
+        std::to_string(writes) + " write, " + std::to_string(contended) +
+        " contended, " + std::to_string(parked) + " parked across " +
+        std::to_string(used) + " stripes\r\n");
+}
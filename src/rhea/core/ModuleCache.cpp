@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <Rhea.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <quickdigest5.hpp>
+#include <rhea/core/ModuleCache.hpp>
+#include <rhea/parser/Parser.hpp>
+#include <rhea/parser/Tokenizer.hpp>
+#include <rhea/util/PathHelper.hpp>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The last byte is the layout version.
+static const char magic[8] = {'R', 'H', 'E', 'A', 'C', 0, 0, 1};
+
+#ifdef RHEA_VERSION
+static const std::string compilerVersion = RHEA_VERSION " " RHEA_BUILD_TIME;
+#else
+static const std::string compilerVersion = "web " __TIME__ " " __DATE__;
+#endif
+
+static void put(std::string& out, const void* value, size_t length) {
+    out.append(static_cast<const char*>(value), length);
+}
+
+static void put(std::string& out, const std::string& value) {
+    uint32_t length = static_cast<uint32_t>(value.size());
+
+    put(out, &length, sizeof length);
+    out.append(value);
+}
+
+static bool take(std::string_view data, size_t& offset, void* value,
+                 size_t length) {
+    if(data.size() - offset < length) return false;
+
+    std::memcpy(value, data.data() + offset, length);
+    offset += length;
+    return true;
+}
+
+static bool take(std::string_view data, size_t& offset, std::string& value) {
+    uint32_t length = 0;
+    if(!take(data, offset, &length, sizeof length) ||
+       data.size() - offset < length)
+        return false;
+
+    value.assign(data.data() + offset, length);
+    offset += length;
+    return true;
+}
+
+std::string ModuleCache::sharedLocation(const std::string& file) {
+    std::string home = RheaUtil::PathHelper::installationPath();
+    if(home.empty()) return "";
+
+    std::error_code error;
+    std::filesystem::path path = std::filesystem::absolute(file, error);
+    std::string key = path.lexically_normal().string();
+
+    // FNV-1a of the absolute path keeps sources of the same name apart.
+    uint64_t hash = UINT64_C(14695981039346656037);
+    for(unsigned char ch : key) {
+        hash ^= ch;
+        hash *= UINT64_C(1099511628211);
+    }
+
+    std::ostringstream name;
+    name << path.stem().string() << "-" << std::hex << std::setw(16)
+         << std::setfill('0') << hash << ".rheac";
+
+    return home + FS_FILE_SEPARATOR + "cache" + FS_FILE_SEPARATOR +
+           name.str();
+}
+
+bool ModuleCache::decode(std::string_view data, ModuleRegistry::Module& module,
+                         std::vector<Token>& tokens) {
+    size_t offset = 0;
+    char header[sizeof magic];
+    std::string version, digest;
+
+    if(!take(data, offset, header, sizeof header) ||
+       std::memcmp(header, magic, sizeof magic) != 0 ||
+       !take(data, offset, version) || version != compilerVersion ||
+       !take(data, offset, digest))
+        return false;
+
+    // The source is hashed only once the rest of the header checks out.
+    std::error_code error;
+    if(!std::filesystem::is_regular_file(module.path, error) ||
+       digest != ModuleRegistry::digest(module))
+        return false;
+
+    uint32_t count = 0;
+    if(!take(data, offset, &count, sizeof count)) return false;
+
+    tokens.reserve(count);
+    for(uint32_t i = 0; i < count; i++) {
+        uint8_t type = 0;
+        int32_t line = 0, column = 0;
+        std::string image;
+
+        if(!take(data, offset, &type, sizeof type) ||
+           type > TokenCategory::OPERATOR.getValue() ||
+           !take(data, offset, &line, sizeof line) ||
+           !take(data, offset, &column, sizeof column) ||
+           !take(data, offset, image)) {
+            tokens.clear();
+            return false;
+        }
+
+        tokens.emplace_back(std::move(image), module.path, line, column,
+                            TokenCategory(type));
+    }
+
+    if(offset == data.size()) return true;
+
+    tokens.clear();
+    return false;
+}
+
+bool ModuleCache::read(const std::string& cacheFile,
+                       ModuleRegistry::Module& module,
+                       std::vector<Token>& tokens) {
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+
+    std::ifstream file(cacheFile, std::ios::binary);
+    if(!file.is_open()) return false;
+
+    std::ostringstream content;
+    content << file.rdbuf();
+
+    return ModuleCache::decode(content.str(), module, tokens);
+
+#else
+
+    int descriptor = open(cacheFile.c_str(), O_RDONLY | O_CLOEXEC);
+    if(descriptor < 0) return false;
+
+    struct stat info;
+    if(fstat(descriptor, &info) != 0 || info.st_size <= 0) {
+        close(descriptor);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+
+    if(data == MAP_FAILED) return false;
+
+    bool decoded = ModuleCache::decode(
+        std::string_view(static_cast<const char*>(data), size), module, tokens);
+    munmap(data, size);
+
+    return decoded;
+
+#endif
+}
+
+std::vector<Token> ModuleCache::load(ModuleRegistry::Module& module) {
+    std::vector<Token> tokens;
+
+    if(ModuleCache::read(module.path + "c", module, tokens)) return tokens;
+
+    std::string shared = ModuleCache::sharedLocation(module.path);
+    if(!shared.empty() && ModuleCache::read(shared, module, tokens))
+        return tokens;
+
+    std::shared_ptr<Tokenizer> tokenizer = Tokenizer::loadFile(module.path);
+    tokenizer->scan();
+
+    return tokenizer->getTokens();
+}
+
+std::string ModuleCache::compile(const std::string& file) {
+    std::shared_ptr<Tokenizer> tokenizer = Tokenizer::loadFile(file);
+    tokenizer->scan();
+
+    // Sources that do not parse are turned down here, not at startup.
+    const std::vector<Token>& tokens = tokenizer->getTokens();
+    Parser parser(tokens);
+    parser.parse();
+
+    std::string data(magic, sizeof magic);
+    put(data, compilerVersion);
+    put(data, QuickDigest5::fileToHash(file));
+
+    uint32_t count = static_cast<uint32_t>(tokens.size());
+    put(data, &count, sizeof count);
+
+    for(const Token& token : tokens) {
+        uint8_t type = token.getType().getValue();
+        int32_t line = token.getLine(), column = token.getColumn();
+
+        put(data, &type, sizeof type);
+        put(data, &line, sizeof line);
+        put(data, &column, sizeof column);
+        put(data, token.getImage());
+    }
+
+    for(const std::string& target :
+        {file + "c", ModuleCache::sharedLocation(file)}) {
+        if(target.empty()) continue;
+
+        std::error_code error;
+        std::filesystem::path path(target);
+        std::filesystem::create_directories(path.parent_path(), error);
+
+        // Written aside and renamed so a running interpreter never maps a
+        // half-written cache.
+        std::string staging = target + ".tmp";
+        {
+            std::ofstream out(staging, std::ios::binary | std::ios::trunc);
+            if(!out.is_open()) continue;
+
+            out.write(data.data(), static_cast<std::streamsize>(data.size()));
+            if(!out.good()) {
+                out.close();
+                std::filesystem::remove(staging, error);
+                continue;
+            }
+        }
+
+        std::filesystem::rename(staging, path, error);
+        if(!error) return target;
+
+        std::filesystem::remove(staging, error);
+    }
+
+    throw std::runtime_error("Cannot write module cache for: " + file);
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <quickdigest5.hpp>
+#include <rhea/core/ModuleRegistry.hpp>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+#include <filesystem>
+#else
+#include <sys/stat.h>
+#endif
+
+std::unordered_map<std::string, ModuleRegistry::Entry> ModuleRegistry::files;
+std::unordered_multimap<uintmax_t, std::shared_ptr<ModuleRegistry::Module>>
+    ModuleRegistry::sizes;
+std::mutex ModuleRegistry::mutex;
+
+void ModuleRegistry::forget(const std::shared_ptr<Module>& module) {
+    auto [first, last] = ModuleRegistry::sizes.equal_range(module->size);
+
+    for(; first != last; ++first)
+        if(first->second == module) {
+            ModuleRegistry::sizes.erase(first);
+            break;
+        }
+}
+
+// Callers hold the mutex.
+bool ModuleRegistry::isCurrent(const std::string& identity, uintmax_t size,
+                               int64_t modified) {
+    auto known = ModuleRegistry::files.find(identity);
+    if(known == ModuleRegistry::files.end()) return false;
+
+    if(known->second.size == size && known->second.modified == modified)
+        return true;
+
+    // Edited since it was loaded, so it is a new module now. A copy of
+    // another file only drops its own entry.
+    if(known->second.module->identity == identity)
+        ModuleRegistry::forget(known->second.module);
+    ModuleRegistry::files.erase(known);
+
+    return false;
+}
+
+std::shared_ptr<ModuleRegistry::Module> ModuleRegistry::claim(
+    const std::string& file) {
+    std::string identity;
+    uintmax_t size = 0;
+    int64_t modified = 0;
+
+#if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+
+    std::error_code error;
+    std::filesystem::path canonical =
+        std::filesystem::weakly_canonical(file, error);
+
+    if(!error) size = std::filesystem::file_size(canonical, error);
+    if(!error)
+        modified = static_cast<int64_t>(
+            std::filesystem::last_write_time(canonical, error)
+                .time_since_epoch()
+                .count());
+
+    // Let the tokenizer report whatever is wrong with the file.
+    if(error) return std::make_shared<Module>(file, file, 0);
+    identity = canonical.string();
+
+#else
+
+    struct stat info;
+    if(stat(file.c_str(), &info) != 0)
+        return std::make_shared<Module>(file, file, 0);
+
+    identity = std::to_string(info.st_dev) + ":" + std::to_string(info.st_ino);
+    size = static_cast<uintmax_t>(info.st_size);
+
+#if defined(__APPLE__)
+    modified = static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1000000000 +
+               static_cast<int64_t>(info.st_mtimespec.tv_nsec);
+#else
+    modified = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 +
+               static_cast<int64_t>(info.st_mtim.tv_nsec);
+#endif
+
+#endif
+
+    std::shared_ptr<Module> module =
+        std::make_shared<Module>(file, identity, size);
+    std::vector<std::shared_ptr<Module>> compared;
+    std::unique_lock<std::mutex> lock(ModuleRegistry::mutex);
+
+    for(;;) {
+        if(ModuleRegistry::isCurrent(identity, size, modified)) return nullptr;
+
+        std::vector<std::shared_ptr<Module>> pending;
+        auto [first, last] = ModuleRegistry::sizes.equal_range(size);
+
+        for(; first != last; ++first)
+            if(std::find(compared.begin(), compared.end(), first->second) ==
+               compared.end())
+                pending.push_back(first->second);
+
+        if(pending.empty()) break;
+
+        // Hashing reads whole files, so other loads go on meanwhile and
+        // anything registered in the meantime is compared on the next
+        // round.
+        lock.unlock();
+
+        std::shared_ptr<Module> original = nullptr;
+        for(const auto& other : pending)
+            if(ModuleRegistry::digest(*other) ==
+               ModuleRegistry::digest(*module)) {
+                original = other;
+                break;
+            }
+
+        lock.lock();
+        if(original) {
+            if(!ModuleRegistry::isCurrent(identity, size, modified))
+                ModuleRegistry::files.emplace(
+                    identity, Entry{size, modified, original});
+
+            return nullptr;
+        }
+
+        compared.insert(compared.end(), pending.begin(), pending.end());
+    }
+
+    ModuleRegistry::files.emplace(identity, Entry{size, modified, module});
+    ModuleRegistry::sizes.emplace(size, module);
+
+    return module;
+}
+
+std::string ModuleRegistry::digest(Module& module) {
+    std::call_once(module.hashed, [&module]() {
+        module.digest = QuickDigest5::fileToHash(module.path);
+    });
+
+    return module.digest;
+}
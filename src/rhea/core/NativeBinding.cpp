@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <rhea/ast/TerminativeSignal.hpp>
+#include <rhea/core/NativeBinding.hpp>
+#include <rhea/core/Runtime.hpp>
+#include <rhea/util/PathHelper.hpp>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
+#include <dlfcn.h>
+#elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+#include <Windows.h>
+#endif
+
+std::unordered_map<std::string, std::unique_ptr<NativeBinding>>
+    NativeBinding::bindings;
+std::unordered_map<std::string, std::string> NativeBinding::paths;
+std::mutex NativeBinding::mutex;
+
+NativeBinding::NativeBinding(std::string _library, std::string _name)
+    : library(std::move(_library)),
+      name(std::move(_name)),
+      function(nullptr),
+      arity(-1),
+      flags(0) {
+}
+
+const std::string& NativeBinding::getName() const {
+    return this->name;
+}
+
+int32_t NativeBinding::getArity() const {
+    return this->arity.load(std::memory_order_relaxed);
+}
+
+bool NativeBinding::isPure() const {
+    return (this->flags.load(std::memory_order_relaxed) &
+            RHEA_NATIVE_PURE) != 0;
+}
+
+bool NativeBinding::isThreadSafe() const {
+    return (this->flags.load(std::memory_order_relaxed) &
+            RHEA_NATIVE_THREAD_SAFE) != 0;
+}
+
+void NativeBinding::mismatch(std::shared_ptr<Token> address,
+                             size_t count) const {
+    int32_t expected = this->arity.load(std::memory_order_relaxed);
+
+    throw TerminativeThrowSignal(
+        std::move(address),
+        "Expecting " + std::to_string(expected) +
+            (expected == 1 ? " argument, got " : " arguments, got ") +
+            std::to_string(count));
+}
+
+void NativeBinding::unbound(const std::shared_ptr<Token>& address,
+                            const std::string& message) {
+    if(address) throw TerminativeThrowSignal(address, message);
+    throw std::runtime_error(message);
+}
+
+NativeFunction NativeBinding::bind(const std::shared_ptr<Token>& address) {
+    void* handle = Runtime::getLoadedLibrary(this->library);
+    if(handle == nullptr)
+        NativeBinding::unbound(address,
+                               "Native library is not loaded: " +
+                                   this->library);
+
+    std::string symbol = this->name;
+    std::replace(symbol.begin(), symbol.end(), '.', '_');
+
+#if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
+
+    auto func =
+        reinterpret_cast<NativeFunction>(dlsym(handle, symbol.c_str()));
+
+#elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+
+    union FunctionCaster {
+        FARPROC proc;
+        NativeFunction func;
+    };
+
+    FunctionCaster caster;
+    caster.proc = GetProcAddress(static_cast<HMODULE>(handle), symbol.c_str());
+    auto func = caster.func;
+
+#else
+
+    NativeFunction func = nullptr;
+
+#endif
+
+    if(!func)
+        NativeBinding::unbound(address,
+                               "Failed to find function: " + this->name);
+
+    // Racing first calls look up the same symbol, so either store wins.
+    this->function.store(func, std::memory_order_release);
+    return func;
+}
+
+std::string NativeBinding::locate(const std::string& libraryName) {
+    std::lock_guard<std::mutex> lock(NativeBinding::mutex);
+    auto known = NativeBinding::paths.find(libraryName);
+
+    if(known != NativeBinding::paths.end()) return known->second;
+
+    std::string path = RheaUtil::PathHelper::findSharedLibrary(libraryName);
+    NativeBinding::paths.emplace(libraryName, path);
+
+    return path;
+}
+
+NativeBinding* NativeBinding::find(const std::string& library,
+                                   const std::string& name) {
+    std::string key = library + '\n' + name;
+    auto known = NativeBinding::bindings.find(key);
+
+    if(known != NativeBinding::bindings.end()) return known->second.get();
+
+    return NativeBinding::bindings
+        .emplace(key, std::make_unique<NativeBinding>(library, name))
+        .first->second.get();
+}
+
+NativeBinding* NativeBinding::get(const std::string& library,
+                                  const std::string& name) {
+    std::lock_guard<std::mutex> lock(NativeBinding::mutex);
+    return NativeBinding::find(library, name);
+}
+
+bool NativeBinding::link(const std::string& library, void* handle) {
+#if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
+
+    auto init = reinterpret_cast<NativeModuleInit>(
+        dlsym(handle, RHEA_MODULE_INIT));
+
+#elif defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
+
+    union InitCaster {
+        FARPROC proc;
+        NativeModuleInit init;
+    };
+
+    InitCaster caster;
+    caster.proc =
+        GetProcAddress(static_cast<HMODULE>(handle), RHEA_MODULE_INIT);
+    auto init = caster.init;
+
+#else
+
+    (void)handle;
+    NativeModuleInit init = nullptr;
+
+#endif
+
+    if(!init) return false;
+
+    // A table from another version is ignored, and its functions looked up
+    // one symbol at a time.
+    const NativeModule* module = init();
+    if(module == nullptr || module->version != RHEA_MODULE_VERSION)
+        return false;
+
+    std::lock_guard<std::mutex> lock(NativeBinding::mutex);
+    for(uint32_t i = 0; i < module->count; i++) {
+        const NativeEntry& entry = module->entries[i];
+        NativeBinding* binding = NativeBinding::find(library, entry.name);
+
+        binding->arity.store(entry.arity, std::memory_order_relaxed);
+        binding->flags.store(entry.flags, std::memory_order_relaxed);
+        binding->function.store(entry.function, std::memory_order_release);
+    }
+
+    return true;
+}
+
+void NativeBinding::unbindAll() {
+    std::lock_guard<std::mutex> lock(NativeBinding::mutex);
+
+    for(auto& [key, binding] : NativeBinding::bindings)
+        binding->function.store(nullptr, std::memory_order_release);
+}
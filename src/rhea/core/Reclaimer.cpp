@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <mutex>
+#include <rhea/core/Reclaimer.hpp>
+
+class Reclaimer::Registry final {
+   public:
+    std::mutex mtx;
+    std::vector<Participant*> participants;
+    std::vector<Retired> orphans;
+
+    Registry() : mtx(), participants(), orphans() {
+    }
+};
+
+class Reclaimer::Departure final {
+   public:
+    ~Departure() {
+        Reclaimer::leave();
+    }
+};
+
+Reclaimer::Registry& Reclaimer::registry() {
+    // Intentionally leaked: detached workers may still retire memory while
+    // static destructors run.
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+void Reclaimer::enroll() {
+    static thread_local Departure departure;
+    (void)departure;
+
+    Registry& registry = Reclaimer::registry();
+    std::lock_guard<std::mutex> lock(registry.mtx);
+
+    Reclaimer::current = new Participant();
+    registry.participants.push_back(Reclaimer::current);
+}
+
+void Reclaimer::leave() {
+    Participant* self = Reclaimer::current;
+    if(self == nullptr) return;
+
+    Registry& registry = Reclaimer::registry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mtx);
+        registry.orphans.insert(registry.orphans.end(), self->retired.begin(),
+                                self->retired.end());
+        std::erase(registry.participants, self);
+    }
+
+    Reclaimer::current = nullptr;
+    delete self;
+}
+
+void Reclaimer::retire(void* pointer, Deleter deleter) {
+    if(Reclaimer::current == nullptr) Reclaimer::enroll();
+
+    auto& retired = Reclaimer::current->retired;
+    retired.push_back(
+        {Reclaimer::epoch.load(std::memory_order_acquire), pointer, deleter});
+
+    if(retired.size() >= Reclaimer::current->threshold) Reclaimer::collect();
+}
+
+void Reclaimer::collect() {
+    if(Reclaimer::current == nullptr) return;
+
+    Registry& registry = Reclaimer::registry();
+    std::vector<Retired> expired;
+    {
+        std::lock_guard<std::mutex> lock(registry.mtx);
+
+        // Readers pinning from here on already see every unlink made
+        // before the bump, so only older pins can still hold retired data.
+        uint64_t safe =
+            Reclaimer::epoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for(const auto* participant : registry.participants) {
+            uint64_t pinned =
+                participant->pinned.load(std::memory_order_seq_cst);
+            if(pinned != 0) safe = std::min(safe, pinned);
+        }
+
+        auto sweep = [&](std::vector<Retired>& retired) {
+            auto kept = std::partition(
+                retired.begin(), retired.end(),
+                [safe](const Retired& entry) { return entry.epoch >= safe; });
+
+            expired.insert(expired.end(), kept, retired.end());
+            retired.erase(kept, retired.end());
+        };
+
+        sweep(Reclaimer::current->retired);
+        sweep(registry.orphans);
+
+        // Back off while another thread holds an old pin, instead of
+        // rescanning a list that cannot shrink on every retire.
+        Reclaimer::current->threshold =
+            std::max<size_t>(64, Reclaimer::current->retired.size() * 2);
+    }
+
+    // Deleters may retire more memory, so they run outside the registry
+    // lock and after the lists are consistent again.
+    for(const auto& entry : expired) entry.deleter(entry.pointer);
+}
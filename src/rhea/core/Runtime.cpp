@@ -17,21 +17,28 @@
  */
 
 #include <Rhea.hpp>
-#include <algorithm>
 #include <exception>
 #include <filesystem>
 #include <iostream>
 #include <mutex>
-#include <quickdigest5.hpp>
 #include <rhea/ast/ASTNode.hpp>
 #include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/Completion.hpp>
 #include <rhea/ast/TerminativeSignal.hpp>
+#include <rhea/core/HandleTable.hpp>
+#include <rhea/core/ModuleCache.hpp>
+#include <rhea/core/ModuleRegistry.hpp>
+#include <rhea/core/NativeBinding.hpp>
 #include <rhea/core/Runtime.hpp>
+#include <rhea/optimizer/Optimizer.hpp>
 #include <rhea/parser/Parser.hpp>
 #include <rhea/parser/ParserException.hpp>
+#include <rhea/parser/SymbolResolver.hpp>
 #include <rhea/parser/Tokenizer.hpp>
 #include <rhea/util/InputHighlighter.hpp>
 #include <rhea/util/Render.hpp>
+#include <rhea/vm/BytecodeCompiler.hpp>
+#include <rhea/vm/VirtualMachine.hpp>
 #include <stack>
 #include <thread>
 #include <vector>
@@ -44,9 +51,11 @@
 #error "Unsupported architecture for shared objects or dynamic libraries."
 #endif
 
-bool Runtime::testMode = false, Runtime::unsafeMode = false;
+bool Runtime::testMode = false, Runtime::unsafeMode = false,
+     Runtime::dumpTree = false;
+RuntimeEngine Runtime::engine = RuntimeEngine::VM;
+OptimizationLevel Runtime::optimizationLevel = OptimizationLevel::O1;
 std::unordered_map<std::string, void*> Runtime::nativeLibraries;
-std::vector<std::string> Runtime::fileHashes;
 std::mutex Runtime::runtimeMtx;
 
 bool Runtime::isTestMode() {
@@ -65,6 +74,30 @@ void Runtime::setUnsafeMode(bool _unsafeMode) {
     Runtime::unsafeMode = _unsafeMode;
 }
 
+RuntimeEngine Runtime::getEngine() {
+    return Runtime::engine;
+}
+
+void Runtime::setEngine(RuntimeEngine _engine) {
+    Runtime::engine = _engine;
+}
+
+OptimizationLevel Runtime::getOptimizationLevel() {
+    return Runtime::optimizationLevel;
+}
+
+void Runtime::setOptimizationLevel(OptimizationLevel _optimizationLevel) {
+    Runtime::optimizationLevel = _optimizationLevel;
+}
+
+bool Runtime::isDumpTree() {
+    return Runtime::dumpTree;
+}
+
+void Runtime::setDumpTree(bool _dumpTree) {
+    Runtime::dumpTree = _dumpTree;
+}
+
 void Runtime::addLoadedLibrary(std::string libName, void* handle) {
 #ifndef __EMSCRIPTEN__
     std::lock_guard<std::mutex> lock(Runtime::runtimeMtx);
@@ -96,23 +129,14 @@ bool Runtime::hasLoadedLibrary(std::string libName) {
 #endif
 }
 
-void Runtime::addFileHash(std::string hash) {
-    std::lock_guard<std::mutex> lock(Runtime::runtimeMtx);
-    Runtime::fileHashes.push_back(hash);
-}
-
-bool Runtime::hasFileHash(std::string hash) {
-    std::lock_guard<std::mutex> lock(Runtime::runtimeMtx);
-    auto begin = Runtime::fileHashes.begin(), end = Runtime::fileHashes.end();
-
-    return std::find(begin, end, hash) != end;
-}
-
 void Runtime::cleanUp() {
 #ifndef __EMSCRIPTEN__
     std::lock_guard<std::mutex> lock(Runtime::runtimeMtx);
     if(Runtime::nativeLibraries.empty()) return;
 
+    HandleTable::closeAll();
+    NativeBinding::unbindAll();
+
     for(const auto& [key, value] : Runtime::nativeLibraries)
         if(value != nullptr)
 #if defined(__unix__) || defined(__linux__) || defined(__APPLE__)
@@ -125,36 +149,18 @@ void Runtime::cleanUp() {
 #endif
 }
 
-#ifndef __EMSCRIPTEN__
-int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
+// Renders an uncaught error without tearing anything down. The interpreter,
+// the REPL, --compile and parallel tasks that failed unawaited all render
+// through here, so their messages stay alike.
+void Runtime::report(const std::exception_ptr& error) {
     try {
-        std::vector<std::string>::iterator iterator;
-
-        parsync(iterator = files.begin(); iterator != files.end(); iterator++) {
-            std::string fileHash = QuickDigest5::fileToHash(*iterator);
-            if(Runtime::hasFileHash(fileHash)) continue;
-            Runtime::addFileHash(fileHash);
-
-            Parser parser = Parser::fromFile(*iterator);
-            parser.parse();
-
-            for(const auto& statement : parser.getGlobalStatements())
-                statement->visit(symbols);
-        }
-
-        return 0;
+        std::rethrow_exception(error);
     } catch(const std::system_error& exc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mSystem Error\u001b[0m]: \u001b[3;37m");
         RheaUtil::renderError(exc.what());
         RheaUtil::renderError("\u001b[0m\r\n");
     } catch(const ASTNodeException& nodeExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
         RheaUtil::renderError(nodeExc.what());
@@ -162,16 +168,10 @@ int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
         RheaUtil::renderError(nodeExc.getAddress()->toString());
         RheaUtil::renderError("\r\n");
     } catch(const LexicalAnalysisException& lexAnlExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError("[\u001b[1;31mLexical Error\u001b[0m]:\r\n\t");
         RheaUtil::renderError(lexAnlExc.what());
         RheaUtil::renderError("\r\n");
     } catch(const ParserException& parserExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mParser Error\u001b[0m]:  \u001b[3;37m");
         RheaUtil::renderError(parserExc.what());
@@ -179,9 +179,6 @@ int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
         RheaUtil::renderError(parserExc.getAddress()->toString());
         RheaUtil::renderError("\r\n");
     } catch(const TerminativeBreakSignal& breakExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mRuntime Error\u001b[0m]: "
             "\u001b[3;37mInvalid break statement signal caught.\u001b[0m"
@@ -189,9 +186,6 @@ int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
         RheaUtil::renderError(breakExc.getAddress().toString());
         RheaUtil::renderError("\r\n");
     } catch(const TerminativeContinueSignal& continueExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mRuntime Error\u001b[0m]: "
             "\u001b[3;37mInvalid continue statement signal caught.\u001b[0m"
@@ -199,16 +193,10 @@ int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
         RheaUtil::renderError(continueExc.getAddress().toString());
         RheaUtil::renderError("\r\n");
     } catch(const TerminativeReturnSignal& retExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError("\u001b[0;93m");
         RheaUtil::renderError(retExc.getObject().toString());
         RheaUtil::renderError("\u001b[0m\r\n");
     } catch(const TerminativeThrowSignal& throwExc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mUncaught Error\u001b[0m]: \u001b[3;37m");
         RheaUtil::renderError(throwExc.getObject().toString());
@@ -216,18 +204,100 @@ int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
         RheaUtil::renderError(throwExc.getAddress()->toString());
         RheaUtil::renderError("\r\n");
     } catch(const std::exception& exc) {
-        symbols.waitForTasks();
-        Runtime::cleanUp();
-
         RheaUtil::renderError(
             "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
         RheaUtil::renderError(exc.what());
         RheaUtil::renderError("\u001b[0m\r\n");
     }
+}
+
+std::vector<std::shared_ptr<ASTNode>> Runtime::optimize(
+    const std::vector<std::shared_ptr<ASTNode>>& statements) {
+    Optimizer optimizer(Runtime::optimizationLevel);
+    std::vector<std::shared_ptr<ASTNode>> optimized =
+        optimizer.optimize(statements);
+
+    if(Runtime::dumpTree) RheaUtil::render(Optimizer::dump(optimized));
+    return optimized;
+}
+
+DynamicObject Runtime::evaluate(
+    SymbolTable& symbols,
+    const std::vector<std::shared_ptr<ASTNode>>& statements) {
+    DynamicObject value;
+
+    if(Runtime::engine == RuntimeEngine::VM)
+        value = VirtualMachine::execute(*BytecodeCompiler::compile(statements),
+                                        symbols);
+    else
+        for(const auto& statement : statements) {
+            value = statement->visit(symbols);
+            if(Completion::isAbrupt()) break;
+        }
+
+    Completion::raise(value);
+    return value;
+}
+
+#ifndef __EMSCRIPTEN__
+int Runtime::interpreter(SymbolTable& symbols, std::vector<std::string> files) {
+    try {
+        std::vector<std::string>::iterator iterator;
+
+        for(iterator = files.begin(); iterator != files.end(); iterator++) {
+            std::shared_ptr<ModuleRegistry::Module> module =
+                ModuleRegistry::claim(*iterator);
+            if(!module) continue;
+
+            Parser parser(ModuleCache::load(*module));
+            parser.parse();
+
+            std::vector<std::shared_ptr<ASTNode>> program =
+                Runtime::optimize(parser.getGlobalStatements());
+            SymbolResolver::resolve(program, symbols);
+            Runtime::evaluate(symbols, program);
+        }
+
+        symbols.waitForTasks();
+        return 0;
+    } catch(...) {
+        symbols.waitForTasks();
+        Runtime::cleanUp();
+        Runtime::report(std::current_exception());
+    }
 
     return 1;
 }
 
+int Runtime::compile(std::vector<std::string> files) {
+    std::vector<std::string> sources;
+    int status = 0;
+
+    for(const std::string& file : files)
+        if(std::filesystem::is_directory(file)) {
+            for(const auto& entry :
+                std::filesystem::recursive_directory_iterator(file))
+                if(entry.is_regular_file() &&
+                   entry.path().extension() == ".rhea")
+                    sources.push_back(entry.path().string());
+        } else
+            sources.push_back(file);
+
+    for(const std::string& source : sources) {
+        try {
+            std::string cache = ModuleCache::compile(source);
+            RheaUtil::render(source + " -> " + cache + "\r\n");
+            continue;
+        } catch(...) {
+            Runtime::report(std::current_exception());
+        }
+
+        status = 1;
+    }
+
+    return status;
+}
+
 void Runtime::showPrompt() {
     std::string workingDir = std::filesystem::current_path().string();
     std::time_t currentTime = std::time(nullptr);
@@ -271,89 +341,13 @@ void Runtime::repl() {
             Parser parser(tokenizer.getTokens());
             parser.parse();
 
-            for(const auto& statement : parser.getGlobalStatements())
-                statement->visit(symtab);
-        } catch(const std::system_error& exc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mSystem Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(exc.what());
-            RheaUtil::renderError("\u001b[0m\r\n");
-        } catch(const ASTNodeException& nodeExc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(nodeExc.what());
-            RheaUtil::renderError("\u001b[0m\r\n                 ");
-            RheaUtil::renderError(nodeExc.getAddress()->toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const LexicalAnalysisException& lexAnlExc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mLexical Error\u001b[0m]:\r\n\t");
-            RheaUtil::renderError(lexAnlExc.what());
-            RheaUtil::renderError("\r\n");
-        } catch(const ParserException& parserExc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mParser Error\u001b[0m]:  \u001b[3;37m");
-            RheaUtil::renderError(parserExc.what());
-            RheaUtil::renderError("\u001b[0m\r\n                 ");
-            RheaUtil::renderError(parserExc.getAddress()->toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const TerminativeBreakSignal& breakExc) {
+            auto statements = Runtime::optimize(parser.getGlobalStatements());
+            SymbolResolver::resolve(statements, symtab);
+            Runtime::evaluate(symtab, statements);
+        } catch(...) {
             symtab.waitForTasks();
             Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: "
-                "\u001b[3;37mInvalid break statement signal caught.\u001b[0m"
-                "\r\n                 ");
-            RheaUtil::renderError(breakExc.getAddress().toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const TerminativeContinueSignal& continueExc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: "
-                "\u001b[3;37mInvalid continue statement signal caught.\u001b[0m"
-                "\r\n                 ");
-            RheaUtil::renderError(continueExc.getAddress().toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const TerminativeReturnSignal& retExc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError("\u001b[0;93m");
-            RheaUtil::renderError(retExc.getObject().toString());
-            RheaUtil::renderError("\u001b[0m\r\n");
-        } catch(const TerminativeThrowSignal& throwExc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mUncaught Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(throwExc.getObject().toString());
-            RheaUtil::renderError("\u001b[0m\r\n                  ");
-            RheaUtil::renderError(throwExc.getAddress()->toString());
-            RheaUtil::renderError("\r\n");
-        } catch(const std::exception& exc) {
-            symtab.waitForTasks();
-            Runtime::cleanUp();
-
-            RheaUtil::renderError(
-                "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-            RheaUtil::renderError(exc.what());
-            RheaUtil::renderError("\u001b[0m\r\n");
+            Runtime::report(std::current_exception());
         }
 
         input.clear();
@@ -374,88 +368,13 @@ void Runtime::execute(const char* sourceCode) {
         Parser parser(tokenizer.getTokens());
         parser.parse();
 
-        for(const auto& statement : parser.getGlobalStatements())
-            statement->visit(symtab);
-    } catch(const std::system_error& exc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mSystem Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(exc.what());
-        RheaUtil::renderError("\u001b[0m\r\n");
-    } catch(const ASTNodeException& nodeExc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(nodeExc.what());
-        RheaUtil::renderError("\u001b[0m\r\n                 ");
-        RheaUtil::renderError(nodeExc.getAddress()->toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const LexicalAnalysisException& lexAnlExc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError("[\u001b[1;31mLexical Error\u001b[0m]:\r\n\t");
-        RheaUtil::renderError(lexAnlExc.what());
-        RheaUtil::renderError("\r\n");
-    } catch(const ParserException& parserExc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mParser Error\u001b[0m]:  \u001b[3;37m");
-        RheaUtil::renderError(parserExc.what());
-        RheaUtil::renderError("\u001b[0m\r\n                 ");
-        RheaUtil::renderError(parserExc.getAddress()->toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const TerminativeBreakSignal& breakExc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: "
-            "\u001b[3;37mInvalid break statement signal caught.\u001b[0m"
-            "\r\n                 ");
-        RheaUtil::renderError(breakExc.getAddress().toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const TerminativeContinueSignal& continueExc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: "
-            "\u001b[3;37mInvalid continue statement signal caught.\u001b[0m"
-            "\r\n                 ");
-        RheaUtil::renderError(continueExc.getAddress().toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const TerminativeReturnSignal& retExc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError("\u001b[0;93m");
-        RheaUtil::renderError(retExc.getObject().toString());
-        RheaUtil::renderError("\u001b[0m\r\n");
-    } catch(const TerminativeThrowSignal& throwExc) {
+        auto statements = Runtime::optimize(parser.getGlobalStatements());
+        SymbolResolver::resolve(statements, symtab);
+        Runtime::evaluate(symtab, statements);
+    } catch(...) {
         symtab.waitForTasks();
         Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mUncaught Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(throwExc.getObject().toString());
-        RheaUtil::renderError("\u001b[0m\r\n                  ");
-        RheaUtil::renderError(throwExc.getAddress()->toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const std::exception& exc) {
-        symtab.waitForTasks();
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(exc.what());
-        RheaUtil::renderError("\u001b[0m\r\n");
+        Runtime::report(std::current_exception());
     }
 }
 
@@ -520,80 +439,8 @@ void Runtime::terminateHandler() {
         std::abort();
     }
 
-    try {
-        std::rethrow_exception(eptr);
-    } catch(const std::system_error& exc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mSystem Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(exc.what());
-        RheaUtil::renderError("\u001b[0m\r\n");
-    } catch(const ASTNodeException& nodeExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(nodeExc.what());
-        RheaUtil::renderError("\u001b[0m\r\n                 ");
-        RheaUtil::renderError(nodeExc.getAddress()->toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const LexicalAnalysisException& lexAnlExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError("[\u001b[1;31mLexical Error\u001b[0m]:\r\n\t");
-        RheaUtil::renderError(lexAnlExc.what());
-        RheaUtil::renderError("\r\n");
-    } catch(const ParserException& parserExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mParser Error\u001b[0m]:  \u001b[3;37m");
-        RheaUtil::renderError(parserExc.what());
-        RheaUtil::renderError("\u001b[0m\r\n                 ");
-        RheaUtil::renderError(parserExc.getAddress()->toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const TerminativeBreakSignal& breakExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: "
-            "\u001b[3;37mInvalid break statement signal caught.\u001b[0m"
-            "\r\n                 ");
-        RheaUtil::renderError(breakExc.getAddress().toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const TerminativeContinueSignal& continueExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: "
-            "\u001b[3;37mInvalid continue statement signal caught.\u001b[0m"
-            "\r\n                 ");
-        RheaUtil::renderError(continueExc.getAddress().toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const TerminativeReturnSignal& retExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError("\u001b[0;93m");
-        RheaUtil::renderError(retExc.getObject().toString());
-        RheaUtil::renderError("\u001b[0m\r\n");
-    } catch(const TerminativeThrowSignal& throwExc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mUncaught Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(throwExc.getObject().toString());
-        RheaUtil::renderError("\u001b[0m\r\n                  ");
-        RheaUtil::renderError(throwExc.getAddress()->toString());
-        RheaUtil::renderError("\r\n");
-    } catch(const std::exception& exc) {
-        Runtime::cleanUp();
-
-        RheaUtil::renderError(
-            "[\u001b[1;31mRuntime Error\u001b[0m]: \u001b[3;37m");
-        RheaUtil::renderError(exc.what());
-        RheaUtil::renderError("\u001b[0m\r\n");
-    }
+    Runtime::cleanUp();
+    Runtime::report(eptr);
 
     std::abort();
 }
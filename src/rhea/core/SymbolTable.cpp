@@ -17,19 +17,175 @@
  */
 
 #include <Rhea.hpp>
+#include <algorithm>
+#include <new>
+#include <stdexcept>
 #include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/core/Reclaimer.hpp>
 #include <rhea/core/Runtime.hpp>
 #include <rhea/core/SymbolTable.hpp>
+#include <rhea/core/TaskScheduler.hpp>
+
+// Boxes are recycled through a small per-thread free list, so rebinding a
+// variable in a hot loop does not hit the allocator every time.
+static constexpr size_t boxCacheSize = 256;
+static thread_local void* boxCache[boxCacheSize];
+static thread_local size_t boxCacheCount = 0;
+
+static const DynamicObject* makeBox(DynamicObject value) {
+    void* block = boxCacheCount != 0 ? boxCache[--boxCacheCount]
+                                     : ::operator new(sizeof(DynamicObject));
+
+    return new(block) DynamicObject(std::move(value));
+}
+
+static void dropBox(void* box) {
+    static_cast<DynamicObject*>(box)->~DynamicObject();
+
+    if(boxCacheCount < boxCacheSize)
+        boxCache[boxCacheCount++] = box;
+    else
+        ::operator delete(box);
+}
+
+static void retireBox(const DynamicObject* box) {
+    Reclaimer::retire(const_cast<DynamicObject*>(box), dropBox);
+}
+
+SymbolTable::Index::Index()
+    : references(1), names(), buckets(new Buckets(64)) {
+}
+
+SymbolTable::Index::Index(const Index& other)
+    : references(1), names(other.names), buckets(nullptr) {
+    size_t capacity = 64;
+    while(capacity < this->names.size() * 2)
+        capacity *= 2;
+
+    auto* target = new Buckets(capacity);
+    for(const Entry& entry : this->names)
+        this->place(*target, entry);
+
+    this->buckets.store(target, std::memory_order_release);
+}
+
+SymbolTable::Index::~Index() {
+    delete this->buckets.load(std::memory_order_relaxed);
+}
+
+void SymbolTable::Index::dropBuckets(void* buckets) {
+    delete static_cast<Buckets*>(buckets);
+}
+
+void SymbolTable::Index::place(Buckets& target, const Entry& entry) {
+    size_t bucket = std::hash<std::string>{}(entry.name) & target.mask;
+    while(target.entries[bucket].load(std::memory_order_relaxed) != nullptr)
+        bucket = (bucket + 1) & target.mask;
+
+    target.entries[bucket].store(&entry, std::memory_order_release);
+}
+
+bool SymbolTable::Index::find(const std::string& name, uint32_t& slot) const {
+    const Buckets* target = this->buckets.load(std::memory_order_acquire);
+    size_t bucket = std::hash<std::string>{}(name) & target->mask;
+
+    for(;;) {
+        const Entry* entry =
+            target->entries[bucket].load(std::memory_order_acquire);
+        if(entry == nullptr) return false;
+
+        if(entry->name == name) {
+            slot = entry->slot;
+            return true;
+        }
+
+        bucket = (bucket + 1) & target->mask;
+    }
+}
+
+uint32_t SymbolTable::Index::insert(const std::string& name) {
+    // Entries live in a deque so growing it never moves the ones readers
+    // may still be looking at.
+    Buckets* current = this->buckets.load(std::memory_order_relaxed);
+    if((this->names.size() + 1) * 2 > current->mask + 1) {
+        auto* grown = new Buckets((current->mask + 1) * 2);
+        for(const Entry& entry : this->names)
+            this->place(*grown, entry);
+
+        this->buckets.store(grown, std::memory_order_release);
+        Reclaimer::retire(current, Index::dropBuckets);
+        current = grown;
+    }
+
+    auto slot = static_cast<uint32_t>(this->names.size());
+    this->place(*current, this->names.emplace_back(Entry{name, slot}));
+
+    return slot;
+}
+
+SymbolTable::SymbolTable(std::shared_ptr<SymbolTable> _parent)
+    : parent(std::move(_parent)),
+      root(this->parent ? this->parent->root : this),
+      serial(SymbolTable::nextSerial(this)),
+      layout(nullptr),
+      globals(nullptr),
+      storage(nullptr),
+      tasks(),
+      mtx() {
+}
+
+SymbolTable::SymbolTable(std::shared_ptr<const SymbolLayout> _layout,
+                         std::shared_ptr<SymbolTable> _parent)
+    : parent(std::move(_parent)),
+      root(this->parent ? this->parent->root : this),
+      serial(SymbolTable::nextSerial(this)),
+      layout(std::move(_layout)),
+      globals(nullptr),
+      storage(this->layout && !this->layout->empty()
+                  ? new Slots(this->layout->size())
+                  : nullptr),
+      tasks(),
+      mtx() {
+}
+
+SymbolTable::SymbolTable(const SymbolTable& other)
+    : std::enable_shared_from_this<SymbolTable>(),
+      parent(other.parent),
+      root(other.parent ? other.root : this),
+      serial(SymbolTable::nextSerial(this)),
+      layout(other.layout),
+      globals(nullptr),
+      storage(nullptr),
+      tasks(),
+      mtx() {
+    this->share(other);
+}
+
+SymbolTable::~SymbolTable() {
+    SymbolTable::join(this->tasks);
+
+    Slots* slots = this->storage.load(std::memory_order_relaxed);
+    if(slots != nullptr) SymbolTable::dropSlots(slots);
+
+    Index* index = this->globals.load(std::memory_order_relaxed);
+    if(index != nullptr) SymbolTable::dropIndex(index);
+}
 
 SymbolTable& SymbolTable::operator=(SymbolTable&& other) noexcept {
     if(this != &other) {
         std::lock_guard<std::recursive_mutex> lock1(this->mtx);
         std::lock_guard<std::recursive_mutex> lock2(other.mtx);
 
-        parent = std::move(other.parent);
-        id = std::move(other.id);
-        table = std::move(other.table);
-        tasks = std::move(other.tasks);
+        this->clear();
+        this->parent = std::move(other.parent);
+        this->root = this->parent ? this->parent->root : this;
+        this->layout = std::move(other.layout);
+        this->globals.store(other.globals.exchange(nullptr),
+                            std::memory_order_release);
+        this->storage.store(other.storage.exchange(nullptr),
+                            std::memory_order_release);
+        this->tasks = std::move(other.tasks);
+        this->serial = SymbolTable::nextSerial(this);
     }
 
     return *this;
@@ -40,123 +196,485 @@ SymbolTable& SymbolTable::operator=(const SymbolTable& other) {
         std::lock_guard<std::recursive_mutex> lock1(this->mtx);
         std::lock_guard<std::recursive_mutex> lock2(other.mtx);
 
+        this->clear();
         this->parent = other.parent;
-        this->table = other.table;
-        this->id = RheaUtil::uniqueKey();
-
+        this->root = this->parent ? this->parent->root : this;
+        this->layout = other.layout;
+        this->share(other);
         this->tasks.clear();
+        this->serial = SymbolTable::nextSerial(this);
     }
 
     return *this;
 }
 
-DynamicObject SymbolTable::getSymbol(std::shared_ptr<Token> reference,
-                                     const std::string& name) {
+uint64_t SymbolTable::nextSerial(const SymbolTable* table) {
+    return table->parent
+               ? 0
+               : SymbolTable::serials.fetch_add(1, std::memory_order_relaxed) +
+                     1;
+}
+
+void SymbolTable::invalidate() {
+    SymbolTable::epoch.fetch_add(1, std::memory_order_release);
+}
+
+void SymbolTable::invalidate(const DynamicObject& previous,
+                             const DynamicObject& next) const {
+    if(this != this->root) return;
+    if(previous.isFunction() || previous.isNative() || next.isFunction() ||
+       next.isNative())
+        SymbolTable::invalidate();
+}
+
+bool SymbolTable::findSlot(const std::string& name, uint32_t& slot) const {
+    if(this == this->root) {
+        Reclaimer::Guard guard;
+        const Index* index = this->globals.load(std::memory_order_acquire);
+        return index != nullptr && index->find(name, slot);
+    }
+
+    if(!this->layout) return false;
+    for(size_t i = 0; i < this->layout->size(); i++)
+        if((*this->layout)[i] == name) {
+            slot = static_cast<uint32_t>(i);
+            return true;
+        }
+
+    return false;
+}
+
+SymbolTable* SymbolTable::findScope(const std::string& name, uint32_t& slot) {
+    for(SymbolTable* scope = this; scope != nullptr;
+        scope = scope->parent.get())
+        if(scope->findSlot(name, slot) && scope->isDefined(slot)) return scope;
+
+    return nullptr;
+}
+
+SymbolTable* SymbolTable::scopeAt(uint32_t depth) {
+    SymbolTable* scope = this;
+    while(depth-- > 0 && scope->parent) scope = scope->parent.get();
+
+    return scope;
+}
+
+void SymbolTable::dropChunk(void* chunk) {
+    auto* shared = static_cast<Chunk*>(chunk);
+    if(shared->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    for(auto& value : shared->values) {
+        const DynamicObject* box = value.load(std::memory_order_relaxed);
+        if(box != nullptr) dropBox(const_cast<DynamicObject*>(box));
+    }
+
+    delete shared;
+}
+
+void SymbolTable::dropSlots(void* slots) {
+    auto* shared = static_cast<Slots*>(slots);
+    if(shared->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;
+
+    for(size_t i = 0; i < shared->size / chunkSize; i++) {
+        Chunk* chunk = shared->chunks[i].load(std::memory_order_relaxed);
+        if(chunk != nullptr) SymbolTable::dropChunk(chunk);
+    }
+
+    delete shared;
+}
+
+void SymbolTable::dropIndex(void* index) {
+    auto* shared = static_cast<Index*>(index);
+    if(shared->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete shared;
+}
+
+const DynamicObject* SymbolTable::find(uint32_t slot) const {
+    const Slots* slots = this->storage.load(std::memory_order_acquire);
+    if(slots == nullptr || slot >= slots->size) return nullptr;
+
+    const Chunk* chunk =
+        slots->chunks[slot / chunkSize].load(std::memory_order_acquire);
+    if(chunk == nullptr) return nullptr;
+
+    return chunk->values[slot % chunkSize].load(std::memory_order_acquire);
+}
+
+bool SymbolTable::isDefined(uint32_t slot) const {
+    Reclaimer::Guard guard;
+    return this->find(slot) != nullptr;
+}
+
+bool SymbolTable::read(uint32_t slot, DynamicObject& value) const {
+    Reclaimer::Guard guard;
+    const DynamicObject* box = this->find(slot);
+    if(box == nullptr) return false;
+
+    value = *box;
+    return true;
+}
+
+void SymbolTable::write(uint32_t slot, DynamicObject value) {
+    // Writers are serialized by the table's mutex, so a plain release store
+    // is enough to publish the new box.
+    static const DynamicObject nil;
+    Slots* slots = this->ownSlots(slot + 1);
+    Chunk* chunk = this->ownChunk(slots, slot / chunkSize);
+
+    auto& cell = chunk->values[slot % chunkSize];
+    const DynamicObject* previous = cell.load(std::memory_order_relaxed);
+    const DynamicObject* next = makeBox(std::move(value));
+
+    cell.store(next, std::memory_order_release);
+    if(this == this->root)
+        this->invalidate(previous != nullptr ? *previous : nil, *next);
+
+    if(previous != nullptr) retireBox(previous);
+}
+
+void SymbolTable::erase(uint32_t slot) {
+    if(!this->isDefined(slot)) return;
+
+    Slots* slots = this->ownSlots(slot + 1);
+    Chunk* chunk = this->ownChunk(slots, slot / chunkSize);
+    const DynamicObject* previous = chunk->values[slot % chunkSize].exchange(
+        nullptr, std::memory_order_acq_rel);
+
+    this->invalidate(*previous, {});
+    retireBox(previous);
+}
+
+SymbolTable::Slots* SymbolTable::ownSlots(size_t size) {
+    Slots* slots = this->storage.load(std::memory_order_relaxed);
+    if(slots != nullptr && slots->size >= size &&
+       slots->references.load(std::memory_order_acquire) == 1)
+        return slots;
+
+    // Unsharing keeps the size; only a table that is too small grows.
+    size_t current = slots != nullptr ? slots->size : 0;
+    auto* owned =
+        new Slots(current >= size ? current : std::max(size, current * 2));
+
+    for(size_t i = 0; i < current / chunkSize; i++) {
+        Chunk* chunk = slots->chunks[i].load(std::memory_order_relaxed);
+        if(chunk == nullptr) continue;
+
+        chunk->references.fetch_add(1, std::memory_order_relaxed);
+        owned->chunks[i].store(chunk, std::memory_order_relaxed);
+    }
+
+    this->storage.store(owned, std::memory_order_release);
+    if(slots != nullptr) Reclaimer::retire(slots, SymbolTable::dropSlots);
+
+    return owned;
+}
+
+SymbolTable::Chunk* SymbolTable::ownChunk(Slots* slots, size_t index) {
+    Chunk* chunk = slots->chunks[index].load(std::memory_order_relaxed);
+    if(chunk != nullptr &&
+       chunk->references.load(std::memory_order_acquire) == 1)
+        return chunk;
+
+    auto* owned = new Chunk();
+    if(chunk != nullptr)
+        for(size_t i = 0; i < chunkSize; i++) {
+            const DynamicObject* box =
+                chunk->values[i].load(std::memory_order_acquire);
+            if(box != nullptr)
+                owned->values[i].store(makeBox(*box),
+                                       std::memory_order_relaxed);
+        }
+
+    slots->chunks[index].store(owned, std::memory_order_release);
+    if(chunk != nullptr) Reclaimer::retire(chunk, SymbolTable::dropChunk);
+
+    return owned;
+}
+
+void SymbolTable::share(const SymbolTable& other) {
+    std::lock_guard<std::recursive_mutex> lock(other.mtx);
+
+    Index* index = other.globals.load(std::memory_order_acquire);
+    if(index != nullptr) {
+        index->references.fetch_add(1, std::memory_order_relaxed);
+        this->globals.store(index, std::memory_order_release);
+    }
+
+    Slots* slots = other.storage.load(std::memory_order_acquire);
+    if(slots != nullptr) {
+        slots->references.fetch_add(1, std::memory_order_relaxed);
+        this->storage.store(slots, std::memory_order_release);
+    }
+}
+
+void SymbolTable::clear() {
+    Slots* slots = this->storage.exchange(nullptr, std::memory_order_acq_rel);
+    if(slots != nullptr) Reclaimer::retire(slots, SymbolTable::dropSlots);
+
+    Index* index = this->globals.exchange(nullptr, std::memory_order_acq_rel);
+    if(index != nullptr) Reclaimer::retire(index, SymbolTable::dropIndex);
+}
+
+void SymbolTable::reset(std::shared_ptr<const SymbolLayout> _layout,
+                        std::shared_ptr<SymbolTable> _parent) {
+    std::vector<std::shared_ptr<Task>> pending;
+    {
+        std::lock_guard<std::recursive_mutex> lock(this->mtx);
+        pending.swap(this->tasks);
+    }
+
+    // Tearing down a frame used to join its tasks through the futures'
+    // destructors; a pooled frame has to do it before it is reused.
+    SymbolTable::join(pending);
     std::lock_guard<std::recursive_mutex> lock(this->mtx);
 
-    if(this->parent && this->parent->hasSymbol(name))
-        return this->parent->getSymbol(std::move(reference), name);
+    this->parent = std::move(_parent);
+    this->root = this->parent ? this->parent->root : this;
+    this->layout = std::move(_layout);
+
+    // Only pooled frames are reset, and nothing else can reach those, so
+    // old values are dropped right away instead of being retired.
+    size_t size = this->layout ? this->layout->size() : 0;
+    Slots* slots = this->storage.load(std::memory_order_relaxed);
+
+    if(slots != nullptr &&
+       (slots->size < size ||
+        slots->references.load(std::memory_order_acquire) != 1)) {
+        SymbolTable::dropSlots(slots);
+        slots = nullptr;
+    }
+
+    if(slots != nullptr)
+        for(size_t i = 0; i < slots->size / chunkSize; i++) {
+            Chunk* chunk = slots->chunks[i].load(std::memory_order_relaxed);
+            if(chunk == nullptr) continue;
+
+            if(chunk->references.load(std::memory_order_acquire) != 1) {
+                SymbolTable::dropChunk(chunk);
+                slots->chunks[i].store(nullptr, std::memory_order_relaxed);
+                continue;
+            }
+
+            for(auto& value : chunk->values) {
+                const DynamicObject* box =
+                    value.load(std::memory_order_relaxed);
+                if(box == nullptr) continue;
+
+                value.store(nullptr, std::memory_order_relaxed);
+                dropBox(const_cast<DynamicObject*>(box));
+            }
+        }
+    else if(size != 0)
+        slots = new Slots(size);
+
+    this->storage.store(slots, std::memory_order_release);
+
+    // Pooled frames are never binding roots, even while they are parked
+    // without a parent.
+    this->serial = 0;
+}
+
+SymbolTable& SymbolTable::getRoot() {
+    return *this->root;
+}
+
+std::shared_ptr<SymbolTable> SymbolTable::getReference() {
+    std::shared_ptr<SymbolTable> reference = this->weak_from_this().lock();
+    if(reference) return reference;
+
+    return std::shared_ptr<SymbolTable>(std::shared_ptr<SymbolTable>(), this);
+}
 
-    if(this->table.count(name) == 1) return this->table[name];
+uint32_t SymbolTable::intern(const std::string& name) {
+    SymbolTable& global = *this->root;
+    uint32_t slot = 0;
 
+    if(global.findSlot(name, slot)) return slot;
+    std::lock_guard<std::recursive_mutex> lock(global.mtx);
+
+    Index* index = global.globals.load(std::memory_order_relaxed);
+    if(index != nullptr && index->find(name, slot)) return slot;
+
+    // Copies share the index, so a shared one is cloned before it grows.
+    if(index != nullptr &&
+       index->references.load(std::memory_order_acquire) == 1)
+        return index->insert(name);
+
+    auto* next = index != nullptr ? new Index(*index) : new Index();
+    slot = next->insert(name);
+
+    global.globals.store(next, std::memory_order_release);
+    if(index != nullptr) Reclaimer::retire(index, SymbolTable::dropIndex);
+
+    return slot;
+}
+
+DynamicObject SymbolTable::getSymbol(std::shared_ptr<Token> reference,
+                                     const std::string& name) {
+    uint32_t slot = 0;
+    SymbolTable* scope = this->findScope(name, slot);
+    DynamicObject value;
+
+    if(scope != nullptr && scope->read(slot, value)) return value;
     throw ASTNodeException(std::move(reference),
                            "Cannot resolve symbol: " + name);
 }
 
+DynamicObject SymbolTable::getSymbol(const std::shared_ptr<Token>& reference,
+                                     const SymbolAddress& address) {
+    SymbolTable* scope = nullptr;
+    switch(address.scope) {
+        case SymbolScope::LOCAL:
+            scope = this->scopeAt(address.depth);
+            break;
+
+        case SymbolScope::GLOBAL:
+            scope = this->root;
+            break;
+
+        case SymbolScope::DYNAMIC:
+        default:
+            return this->getSymbol(reference, reference->getImage());
+    }
+
+    DynamicObject value;
+    if(scope->read(address.slot, value)) return value;
+
+    throw ASTNodeException(reference,
+                           "Cannot resolve symbol: " + reference->getImage());
+}
+
 void SymbolTable::setSymbol(std::shared_ptr<Token> reference,
                             DynamicObject value) {
-    std::lock_guard<std::recursive_mutex> lock(this->mtx);
-
     std::string name = reference->getImage();
-    if(this->table.count(name) == 1) {
-        DynamicObject& current = this->table[name];
-        if(current.hasLock()) return;
+    uint32_t slot = 0;
+    SymbolTable* scope = this->findScope(name, slot);
 
-        current = std::move(value);
-    } else if(this->parent && this->parent->hasSymbol(name))
-        this->parent->setSymbol(std::move(reference), std::move(value));
-    else
-        this->table[name] = std::move(value);
-}
+    if(scope == nullptr) {
+        for(scope = this; scope != this->root; scope = scope->parent.get())
+            if(scope->findSlot(name, slot)) break;
 
-void SymbolTable::removeSymbol(std::string name) {
-    std::lock_guard<std::recursive_mutex> lock(this->mtx);
+        if(scope == this->root) slot = this->intern(name);
+    }
 
-    if(this->parent && this->parent->hasSymbol(name)) {
-        this->parent->removeSymbol(name);
-        return;
+    scope->awaitWritable(reference, name, slot);
+    std::lock_guard<std::recursive_mutex> lock(scope->mtx);
+    scope->write(slot, std::move(value));
+}
+
+void SymbolTable::setSymbol(const std::shared_ptr<Token>& reference,
+                            const SymbolAddress& address,
+                            DynamicObject value) {
+    SymbolTable* scope = nullptr;
+    switch(address.scope) {
+        case SymbolScope::LOCAL:
+            scope = this->scopeAt(address.depth);
+            break;
+
+        case SymbolScope::GLOBAL:
+            scope = this->root;
+            break;
+
+        case SymbolScope::DYNAMIC:
+        default:
+            this->setSymbol(reference, std::move(value));
+            return;
     }
 
-    if(this->table.count(name) == 1 && !this->table[name].hasLock())
-        this->table.erase(name);
+    scope->awaitWritable(reference, reference ? reference->getImage() : "",
+                         address.slot);
+    std::lock_guard<std::recursive_mutex> lock(scope->mtx);
+    scope->write(address.slot, std::move(value));
+}
+
+void SymbolTable::removeSymbol(std::string name) {
+    uint32_t slot = 0;
+    SymbolTable* scope = this->findScope(name, slot);
+    if(scope == nullptr) return;
+
+    scope->awaitWritable(nullptr, name, slot);
+    std::lock_guard<std::recursive_mutex> lock(scope->mtx);
+    scope->erase(slot);
 }
 
 void SymbolTable::removeSymbol(std::shared_ptr<Token> name) {
-    std::lock_guard<std::recursive_mutex> lock(this->mtx);
     std::string symbol = name->getImage();
+    uint32_t slot = 0;
+    SymbolTable* scope = this->findScope(symbol, slot);
 
-    if(this->parent && this->parent->hasSymbol(symbol)) {
-        this->parent->removeSymbol(name);
-        return;
-    }
-
-    if(this->table.count(symbol) == 1 && !this->table[symbol].hasLock()) {
-        this->table.erase(symbol);
+    if(scope != nullptr) {
+        scope->awaitWritable(name, symbol, slot);
+        std::lock_guard<std::recursive_mutex> lock(scope->mtx);
+        scope->erase(slot);
         return;
     }
 
     throw ASTNodeException(std::move(name), "Cannot remove symbol: " + symbol);
 }
 
+void SymbolTable::awaitWritable(const std::shared_ptr<Token>& reference,
+                                const std::string& name, uint32_t slot) {
+    if(LockTable::awaitWritable(this, slot)) return;
+
+    std::string message =
+        "Cannot write to " + name + " while holding a read lock on it.";
+    if(reference) throw ASTNodeException(reference, message);
+
+    throw std::runtime_error(message);
+}
+
 bool SymbolTable::hasSymbol(const std::string& name) {
-    std::lock_guard<std::recursive_mutex> lock(this->mtx);
+    uint32_t slot = 0;
+    return this->findScope(name, slot) != nullptr;
+}
 
-    return (this->parent && this->parent->hasSymbol(name)) ||
-           this->table.count(name) == 1;
+bool SymbolTable::findLocal(uint32_t slot, DynamicObject& value) const {
+    return this->read(slot, value);
 }
 
-void SymbolTable::addParallelism(std::future<void> par) {
+void SymbolTable::addParallelism(std::shared_ptr<Task> par) {
     std::lock_guard<std::recursive_mutex> lock(this->mtx);
     this->tasks.push_back(std::move(par));
 }
 
+void SymbolTable::join(const std::vector<std::shared_ptr<Task>>& pending) {
+    for(const auto& task : pending) {
+        if(!task->isFinished()) TaskScheduler::getInstance().wait(task);
+        if(task->isObserved()) continue;
+
+        try {
+            task->get();
+        } catch(...) {
+            Runtime::report(std::current_exception());
+        }
+    }
+}
+
 void SymbolTable::waitForTasks() {
-    std::vector<std::future<void>> currentTasks;
+    std::vector<std::shared_ptr<Task>> currentTasks;
     {
         std::lock_guard<std::recursive_mutex> lock(this->mtx);
         currentTasks = std::move(this->tasks);
         this->tasks.clear();
     }
 
-    if(!currentTasks.empty()) {
-        parsync(size_t i = 0; i < currentTasks.size(); ++i) {
-            auto& task = currentTasks[i];
-            if(task.valid()) task.get();
-        }
-    }
-
+    SymbolTable::join(currentTasks);
     if(this->parent) this->parent->waitForTasks();
 }
 
-void SymbolTable::lock(std::string name, SymbolTable& requestOrigin) {
-    std::lock_guard<std::recursive_mutex> lock(this->mtx);
-
-    if(this->table.count(name) == 1) {
-        DynamicObject& current = this->table[name];
-        if(current.hasLock()) return;
+LockTable::Guard SymbolTable::lock(const std::shared_ptr<Token>& variable,
+                                   LockMode mode) {
+    uint32_t slot = 0;
+    SymbolTable* scope = this->findScope(variable->getImage(), slot);
 
-        current.own(requestOrigin.id);
-        current.lock();
-    } else if(this->parent)
-        this->parent->lock(name, requestOrigin);
-}
-
-void SymbolTable::unlock(std::string name, SymbolTable& requestOrigin) {
-    std::lock_guard<std::recursive_mutex> lock(this->mtx);
+    // Two readers upgrading at once would wait on each other forever.
+    if(mode == LockMode::WRITE && LockTable::isReading(scope, slot))
+        throw ASTNodeException(variable,
+                               "Cannot lock " + variable->getImage() +
+                                   " for writing while holding a read lock "
+                                   "on it.");
 
-    if(this->table.count(name) == 1 &&
-       this->table[name].ownerId() == requestOrigin.id)
-        this->table[name].unlock();
-    else if(this->parent)
-        this->parent->unlock(name, requestOrigin);
+    return LockTable::Guard(scope, slot, mode);
 }
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/core/Task.hpp>
+
+bool Task::run() {
+    if(this->claimed.exchange(true, std::memory_order_acq_rel)) return false;
+
+    Task* outer = Task::current;
+    Task::current = this;
+
+    try {
+        this->value = this->work();
+    } catch(...) {
+        this->error = std::current_exception();
+    }
+    Task::current = outer;
+
+    this->work = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->finished.store(true, std::memory_order_release);
+    }
+
+    this->done.notify_all();
+    return true;
+}
+
+bool Task::isFinished() const {
+    return this->finished.load(std::memory_order_acquire);
+}
+
+bool Task::isObserved() const {
+    return this->observed.load(std::memory_order_acquire);
+}
+
+bool Task::isRunning() {
+    return Task::current != nullptr;
+}
+
+Task* Task::getCurrent() {
+    return Task::current;
+}
+
+void Task::waitFor(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(this->mtx);
+    this->done.wait_for(lock, timeout, [this]() {
+        return this->finished.load(std::memory_order_acquire);
+    });
+}
+
+DynamicObject Task::get() {
+    this->observed.store(true, std::memory_order_release);
+    if(this->error) std::rethrow_exception(this->error);
+
+    return this->value;
+}
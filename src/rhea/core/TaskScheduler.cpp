@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <rhea/core/LockTable.hpp>
+#include <rhea/core/TaskScheduler.hpp>
+
+TaskScheduler::TaskScheduler(size_t count)
+    : queues(),
+      workers(),
+      next(0),
+      queued(0),
+      mtx(),
+      available(),
+      blocked(0),
+      spares(0) {
+    for(size_t i = 0; i < count; i++)
+        this->queues.push_back(std::make_unique<Queue>());
+
+    for(size_t i = 0; i < count; i++)
+        this->workers.emplace_back(&TaskScheduler::work, this, i);
+}
+
+TaskScheduler& TaskScheduler::getInstance() {
+    // Intentionally leaked: workers may still be running detached script
+    // code when the process exits, so they are never joined.
+    static TaskScheduler* instance =
+        new TaskScheduler(TaskScheduler::getThreadCount());
+    return *instance;
+}
+
+size_t TaskScheduler::getThreadCount() {
+    if(TaskScheduler::threadCount != 0) return TaskScheduler::threadCount;
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+void TaskScheduler::setThreadCount(size_t count) {
+    TaskScheduler::threadCount = count;
+}
+
+void TaskScheduler::work(size_t index) {
+    TaskScheduler::workerIndex = index;
+    TaskScheduler::pooled = true;
+
+    while(true) {
+        std::shared_ptr<Task> task = this->acquire();
+        if(task) {
+            task->run();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(this->mtx);
+        this->available.wait(lock, [this]() {
+            return this->queued.load(std::memory_order_acquire) != 0;
+        });
+    }
+}
+
+void TaskScheduler::cover() {
+    TaskScheduler::pooled = true;
+
+    while(true) {
+        {
+            std::lock_guard<std::mutex> lock(this->mtx);
+            if(this->spares > this->blocked) {
+                this->spares--;
+                return;
+            }
+        }
+
+        std::shared_ptr<Task> task = this->acquire();
+        if(task) {
+            task->run();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(this->mtx);
+        this->available.wait(lock, [this]() {
+            return this->queued.load(std::memory_order_acquire) != 0 ||
+                   this->spares > this->blocked;
+        });
+    }
+}
+
+void TaskScheduler::block() {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    if(++this->blocked <= this->spares) return;
+
+    this->spares++;
+    std::thread(&TaskScheduler::cover, this).detach();
+}
+
+void TaskScheduler::unblock() {
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->blocked--;
+    }
+
+    this->available.notify_all();
+}
+
+TaskScheduler::Blocking::Blocking() : counted(TaskScheduler::pooled) {
+    if(this->counted) TaskScheduler::getInstance().block();
+}
+
+TaskScheduler::Blocking::~Blocking() {
+    if(this->counted) TaskScheduler::getInstance().unblock();
+}
+
+std::shared_ptr<Task> TaskScheduler::acquire() {
+    size_t count = this->queues.size();
+    size_t self = TaskScheduler::workerIndex;
+
+    if(self < count) {
+        Queue& own = *this->queues[self];
+        std::lock_guard<std::mutex> lock(own.mtx);
+
+        if(!own.tasks.empty()) {
+            std::shared_ptr<Task> task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+
+            this->queued.fetch_sub(1, std::memory_order_acq_rel);
+            return task;
+        }
+    }
+
+    size_t start = self < count ? self + 1
+                                : this->next.load(std::memory_order_relaxed);
+    for(size_t i = 0; i < count; i++) {
+        Queue& victim = *this->queues[(start + i) % count];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+
+        if(victim.tasks.empty()) continue;
+        std::shared_ptr<Task> task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+
+        this->queued.fetch_sub(1, std::memory_order_acq_rel);
+        return task;
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<Task> TaskScheduler::submit(
+    std::function<DynamicObject()> task) {
+    auto scheduled = std::make_shared<Task>(std::move(task));
+    size_t count = this->queues.size();
+    size_t index = TaskScheduler::workerIndex < count
+                       ? TaskScheduler::workerIndex
+                       : this->next.fetch_add(1, std::memory_order_relaxed) %
+                             count;
+
+    {
+        Queue& queue = *this->queues[index];
+        std::lock_guard<std::mutex> lock(queue.mtx);
+        queue.tasks.push_back(scheduled);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->queued.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    this->available.notify_one();
+    return scheduled;
+}
+
+bool TaskScheduler::runPending() {
+    std::shared_ptr<Task> task = this->acquire();
+    if(!task) return false;
+
+    task->run();
+    return true;
+}
+
+void TaskScheduler::wait(const std::shared_ptr<Task>& task) {
+    // Unrelated tasks run inline could need a lock held further up this
+    // thread's stack and park on it for good, so a thread holding locks
+    // only ever runs the task it waits for.
+    bool helping = !LockTable::isHolding();
+
+    while(!task->isFinished()) {
+        if(task->run()) break;
+        if(helping && this->runPending()) continue;
+
+        task->waitFor(std::chrono::milliseconds(1));
+    }
+}
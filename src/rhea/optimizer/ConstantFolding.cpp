@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <exception>
+#include <rhea/ast/expression/BinaryExpression.hpp>
+#include <rhea/ast/expression/GroupedExpression.hpp>
+#include <rhea/ast/expression/NilCoalescingExpression.hpp>
+#include <rhea/ast/expression/UnaryExpression.hpp>
+#include <rhea/optimizer/ConstantFolding.hpp>
+
+std::shared_ptr<ASTNode> ConstantFolding::rewrite(
+    const std::shared_ptr<ASTNode>& node) {
+    ASTNode* raw = node.get();
+    DynamicObject left, right;
+
+    try {
+        if(auto* binary = dynamic_cast<BinaryExpression*>(raw)) {
+            if(binary->getOperator() != BinaryOperator::ASSIGN &&
+               ConstantFolding::isConstant(binary->getLeft(), left) &&
+               ConstantFolding::isConstant(binary->getRight(), right)) {
+                auto folded = ConstantFolding::makeConstant(
+                    binary->getAddress(),
+                    BinaryExpression::applyOperator(binary->getAddress(),
+                                                    binary->getOperator(),
+                                                    left, right));
+                if(folded) return folded;
+            }
+        } else if(auto* unary = dynamic_cast<UnaryExpression*>(raw)) {
+            if(ConstantFolding::isConstant(unary->getExpression(), left)) {
+                auto folded = ConstantFolding::makeConstant(
+                    unary->getAddress(),
+                    UnaryExpression::applyOperator(
+                        unary->getAddress(), unary->getOperator(), left));
+                if(folded) return folded;
+            }
+        }
+    } catch(const std::exception&) {
+        return node;
+    }
+
+    if(auto* grouped = dynamic_cast<GroupedExpression*>(raw)) {
+        if(ConstantFolding::isConstant(grouped->getExpression(), left))
+            return grouped->getExpression();
+    } else if(auto* coalesce = dynamic_cast<NilCoalescingExpression*>(raw)) {
+        if(ConstantFolding::isConstant(coalesce->getLeft(), left))
+            return left.isNil() ? coalesce->getRight() : coalesce->getLeft();
+    }
+
+    return node;
+}
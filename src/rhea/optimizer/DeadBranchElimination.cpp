@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/expression/IfElseExpression.hpp>
+#include <rhea/ast/expression/NilLiteralExpression.hpp>
+#include <rhea/ast/expression/UnlessExpression.hpp>
+#include <rhea/ast/expression/WhileExpression.hpp>
+#include <rhea/optimizer/DeadBranchElimination.hpp>
+
+static std::shared_ptr<ASTNode> pickBranch(
+    const std::shared_ptr<ASTNode>& node, bool taken,
+    const std::shared_ptr<ASTNode>& thenBranch,
+    const std::shared_ptr<ASTNode>& elseBranch) {
+    if(taken) return thenBranch;
+    if(elseBranch) return elseBranch;
+
+    return std::make_shared<NilLiteralExpression>(node->getAddress());
+}
+
+std::shared_ptr<ASTNode> DeadBranchElimination::rewrite(
+    const std::shared_ptr<ASTNode>& node) {
+    ASTNode* raw = node.get();
+    DynamicObject condition;
+
+    if(auto* ifElse = dynamic_cast<IfElseExpression*>(raw)) {
+        if(DeadBranchElimination::isConstant(ifElse->getCondition(),
+                                             condition))
+            return pickBranch(node, condition.booleanEquivalent(),
+                              ifElse->getThenBranch(),
+                              ifElse->getElseBranch());
+    } else if(auto* unless = dynamic_cast<UnlessExpression*>(raw)) {
+        if(DeadBranchElimination::isConstant(unless->getCondition(),
+                                             condition))
+            return pickBranch(node, !condition.booleanEquivalent(),
+                              unless->getThenBranch(),
+                              unless->getElseBranch());
+    } else if(auto* whileExpr = dynamic_cast<WhileExpression*>(raw)) {
+        if(DeadBranchElimination::isConstant(whileExpr->getCondition(),
+                                             condition) &&
+           !condition.booleanEquivalent())
+            return std::make_shared<NilLiteralExpression>(node->getAddress());
+    }
+
+    return node;
+}
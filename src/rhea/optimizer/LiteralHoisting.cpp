@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <rhea/ast/expression/RegexExpression.hpp>
+#include <rhea/ast/expression/StringLiteralExpression.hpp>
+#include <rhea/core/RegexWrapper.hpp>
+#include <rhea/optimizer/LiteralHoisting.hpp>
+#include <stdexcept>
+
+std::shared_ptr<ASTNode> LiteralHoisting::rewrite(
+    const std::shared_ptr<ASTNode>& node) {
+    ASTNode* raw = node.get();
+
+    if(auto* str = dynamic_cast<StringLiteralExpression*>(raw)) {
+        const std::string& value = str->getValue();
+        auto entry = this->strings.find(value);
+
+        if(entry == this->strings.end())
+            entry = this->strings.emplace(value, DynamicObject(value)).first;
+        str->setConstant(entry->second);
+    } else if(auto* regex = dynamic_cast<RegexExpression*>(raw)) {
+        const std::string& pattern = regex->getPattern();
+        auto entry = this->regexes.find(pattern);
+
+        if(entry == this->regexes.end()) {
+            std::shared_ptr<RegexWrapper> wrapper;
+
+            try {
+                wrapper = std::make_shared<RegexWrapper>(pattern);
+            } catch(const std::runtime_error&) {
+                return node;
+            }
+
+            entry = this->regexes.emplace(pattern, DynamicObject(wrapper))
+                        .first;
+        }
+
+        regex->setConstant(entry->second);
+    }
+
+    return node;
+}
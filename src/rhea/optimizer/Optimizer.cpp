@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <cstdlib>
+#include <rhea/ast/expression/AssignmentExpression.hpp>
+#include <rhea/ast/expression/BinaryExpression.hpp>
+#include <rhea/ast/expression/BooleanLiteralExpression.hpp>
+#include <rhea/ast/expression/NumberLiteralExpression.hpp>
+#include <rhea/ast/expression/RegexExpression.hpp>
+#include <rhea/ast/expression/StringLiteralExpression.hpp>
+#include <rhea/ast/expression/UnaryExpression.hpp>
+#include <rhea/ast/expression/VariableAccessExpression.hpp>
+#include <rhea/optimizer/ConstantFolding.hpp>
+#include <rhea/optimizer/DeadBranchElimination.hpp>
+#include <rhea/optimizer/LiteralHoisting.hpp>
+#include <rhea/optimizer/Optimizer.hpp>
+#include <typeinfo>
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
+static std::string nodeName(const ASTNode& node) {
+    std::string name = typeid(node).name();
+
+#if defined(__GNUC__) || defined(__clang__)
+    int status = 0;
+    char* demangled =
+        abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+
+    if(status == 0 && demangled != nullptr) name = demangled;
+    std::free(demangled);
+#else
+    if(name.rfind("class ", 0) == 0) name = name.substr(6);
+#endif
+
+    return name;
+}
+
+Optimizer::Optimizer(OptimizationLevel level) : passes() {
+    if(level == OptimizationLevel::O0) return;
+
+    this->addPass(std::make_unique<ConstantFolding>());
+    this->addPass(std::make_unique<DeadBranchElimination>());
+
+    if(level == OptimizationLevel::O2)
+        this->addPass(std::make_unique<LiteralHoisting>());
+}
+
+void Optimizer::addPass(std::unique_ptr<OptimizerPass> pass) {
+    this->passes.push_back(std::move(pass));
+}
+
+void Optimizer::run(OptimizerPass& pass, std::shared_ptr<ASTNode>& node) {
+    if(!node) return;
+
+    node->forEachChild([&pass](std::shared_ptr<ASTNode>& child) {
+        Optimizer::run(pass, child);
+    });
+    node = pass.rewrite(node);
+}
+
+std::vector<std::shared_ptr<ASTNode>> Optimizer::optimize(
+    const std::vector<std::shared_ptr<ASTNode>>& statements) {
+    std::vector<std::shared_ptr<ASTNode>> optimized = statements;
+
+    for(const auto& pass : this->passes)
+        for(auto& statement : optimized) Optimizer::run(*pass, statement);
+
+    return optimized;
+}
+
+void Optimizer::dumpNode(const std::shared_ptr<ASTNode>& node, size_t depth,
+                         std::string& output) {
+    if(!node) return;
+
+    ASTNode* raw = node.get();
+    output += std::string(depth * 2, ' ') + nodeName(*raw);
+
+    if(auto* number = dynamic_cast<NumberLiteralExpression*>(raw))
+        output += " " + DynamicObject(number->getValue()).toString();
+    else if(auto* str = dynamic_cast<StringLiteralExpression*>(raw))
+        output += " \"" + str->getValue() + "\"";
+    else if(auto* boolean = dynamic_cast<BooleanLiteralExpression*>(raw))
+        output += boolean->getValue() ? " true" : " false";
+    else if(auto* regex = dynamic_cast<RegexExpression*>(raw))
+        output += " `" + regex->getPattern() + "`";
+    else if(auto* variable = dynamic_cast<VariableAccessExpression*>(raw))
+        output += " " + variable->getName().getImage();
+    else if(auto* assignment = dynamic_cast<AssignmentExpression*>(raw))
+        output += " " + assignment->getVariable()->getName().getImage();
+    else if(dynamic_cast<BinaryExpression*>(raw) ||
+            dynamic_cast<UnaryExpression*>(raw))
+        output += " " + raw->getAddress()->getImage();
+
+    output += "\r\n";
+    raw->forEachChild([depth, &output](std::shared_ptr<ASTNode>& child) {
+        Optimizer::dumpNode(child, depth + 1, output);
+    });
+}
+
+std::string Optimizer::dump(
+    const std::vector<std::shared_ptr<ASTNode>>& statements) {
+    std::string output;
+
+    for(const auto& statement : statements)
+        Optimizer::dumpNode(statement, 0, output);
+    return output;
+}
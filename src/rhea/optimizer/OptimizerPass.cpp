@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/expression/BooleanLiteralExpression.hpp>
+#include <rhea/ast/expression/NilLiteralExpression.hpp>
+#include <rhea/ast/expression/NumberLiteralExpression.hpp>
+#include <rhea/ast/expression/StringLiteralExpression.hpp>
+#include <rhea/optimizer/OptimizerPass.hpp>
+
+bool OptimizerPass::isConstant(const std::shared_ptr<ASTNode>& node,
+                               DynamicObject& value) {
+    ASTNode* raw = node.get();
+
+    if(auto* number = dynamic_cast<NumberLiteralExpression*>(raw))
+        value = DynamicObject(number->getValue());
+    else if(auto* str = dynamic_cast<StringLiteralExpression*>(raw))
+        value = DynamicObject(str->getValue());
+    else if(auto* boolean = dynamic_cast<BooleanLiteralExpression*>(raw))
+        value = DynamicObject(boolean->getValue());
+    else if(dynamic_cast<NilLiteralExpression*>(raw))
+        value = {};
+    else
+        return false;
+
+    return true;
+}
+
+std::shared_ptr<ASTNode> OptimizerPass::makeConstant(
+    std::shared_ptr<Token> address, const DynamicObject& value) {
+    if(value.isNumber())
+        return std::make_shared<NumberLiteralExpression>(std::move(address),
+                                                         value.getNumber());
+    else if(value.isString())
+        return std::make_shared<StringLiteralExpression>(std::move(address),
+                                                         value.getString());
+    else if(value.isBool())
+        return std::make_shared<BooleanLiteralExpression>(std::move(address),
+                                                          value.getBool());
+    else if(value.isNil())
+        return std::make_shared<NilLiteralExpression>(std::move(address));
+
+    return nullptr;
+}
@@ -19,7 +19,10 @@
 #include <memory>
 #include <rhea/ast/ASTNode.hpp>
 #include <rhea/ast/expression/ArrayAccessExpression.hpp>
+#include <rhea/ast/expression/ArrayAssignmentExpression.hpp>
 #include <rhea/ast/expression/ArrayExpression.hpp>
+#include <rhea/ast/expression/AssignmentExpression.hpp>
+#include <rhea/ast/expression/AwaitExpression.hpp>
 #include <rhea/ast/expression/BinaryExpression.hpp>
 #include <rhea/ast/expression/BlockExpression.hpp>
 #include <rhea/ast/expression/BooleanLiteralExpression.hpp>
@@ -34,6 +37,7 @@
 #include <rhea/ast/expression/NilLiteralExpression.hpp>
 #include <rhea/ast/expression/NumberLiteralExpression.hpp>
 #include <rhea/ast/expression/ParallelExpression.hpp>
+#include <rhea/ast/expression/ParallelLoopExpression.hpp>
 #include <rhea/ast/expression/RandomExpression.hpp>
 #include <rhea/ast/expression/RegexExpression.hpp>
 #include <rhea/ast/expression/RenderExpression.hpp>
@@ -351,12 +355,113 @@ std::shared_ptr<ASTNode> Parser::exprRandom() {
 
 std::shared_ptr<ASTNode> Parser::exprParallel() {
     Token address = this->consume("parallel");
+    if(this->isNext("loop", TokenCategory::KEYWORD))
+        return this->exprParallelLoop(address);
+
     std::shared_ptr<ASTNode> expression = this->expression();
 
     return std::make_shared<ParallelExpression>(
         std::make_shared<Token>(address), std::move(expression));
 }
 
+static bool isCounter(const std::shared_ptr<ASTNode>& node,
+                      const std::string& name) {
+    auto* variable = dynamic_cast<VariableAccessExpression*>(node.get());
+    return variable != nullptr && variable->getName().getImage() == name;
+}
+
+std::shared_ptr<ASTNode> Parser::exprParallelLoop(const Token& address) {
+    this->consume("loop");
+    this->consume("(");
+
+    std::shared_ptr<ASTNode> initial = this->expression();
+    this->consume(";");
+
+    std::shared_ptr<ASTNode> condition = this->expression();
+    this->consume(";");
+
+    std::shared_ptr<ASTNode> postexpr = this->expression();
+    std::vector<ParallelReduction> reductions;
+
+    if(this->isNext(";", TokenCategory::OPERATOR)) {
+        this->consume(";");
+
+        reductions.push_back(this->reduction());
+        while(this->isNext(",", TokenCategory::OPERATOR)) {
+            this->consume(",");
+            reductions.push_back(this->reduction());
+        }
+    }
+    this->consume(")");
+
+    auto start = std::dynamic_pointer_cast<AssignmentExpression>(initial);
+    auto check = std::dynamic_pointer_cast<BinaryExpression>(condition);
+    auto update = std::dynamic_pointer_cast<AssignmentExpression>(postexpr);
+    auto increment = update ? std::dynamic_pointer_cast<BinaryExpression>(
+                                  update->getValue())
+                            : nullptr;
+
+    std::string name =
+        start ? start->getVariable()->getName().getImage() : std::string();
+    BinaryOperator comparison =
+        check ? check->getOperator() : BinaryOperator::ASSIGN;
+    BinaryOperator stepping =
+        increment ? increment->getOperator() : BinaryOperator::ASSIGN;
+
+    if(!start || !check || !increment ||
+       update->getVariable()->getName().getImage() != name ||
+       !isCounter(check->getLeft(), name) ||
+       !isCounter(increment->getLeft(), name) ||
+       (comparison != BinaryOperator::LESS &&
+        comparison != BinaryOperator::LESS_EQUAL &&
+        comparison != BinaryOperator::GREATER &&
+        comparison != BinaryOperator::GREATER_EQUAL) ||
+       (stepping != BinaryOperator::ADD && stepping != BinaryOperator::SUB))
+        throw ParserException(
+            std::make_shared<Token>(address),
+            "Parallel loop expects a counted header like "
+            "loop(i = start; i < end; i = i + step).");
+
+    std::shared_ptr<ASTNode> body = this->expression();
+    return std::make_shared<ParallelLoopExpression>(
+        std::make_shared<Token>(address), std::move(start), comparison,
+        check->getRight(), increment->getRight(),
+        stepping == BinaryOperator::SUB, std::move(body),
+        std::move(reductions));
+}
+
+ParallelReduction Parser::reduction() {
+    Token token = this->consume(this->peek().getType());
+    ReductionOperator op = ReductionOperator::ADD;
+
+    if(token.getImage() == "+")
+        op = ReductionOperator::ADD;
+    else if(token.getImage() == "*")
+        op = ReductionOperator::MUL;
+    else if(token.getImage() == "min")
+        op = ReductionOperator::MIN;
+    else if(token.getImage() == "max")
+        op = ReductionOperator::MAX;
+    else if(token.getImage() == "append")
+        op = ReductionOperator::APPEND;
+    else
+        throw ParserException(std::make_shared<Token>(token),
+                              "Unknown reduction operator: " +
+                                  token.getImage());
+
+    this->consume(":");
+    return {op, std::make_shared<VariableAccessExpression>(
+                    std::make_shared<Token>(this->getIdentifier()))};
+}
+
+std::shared_ptr<ASTNode> Parser::exprAwait() {
+    Token address = this->consume("await");
+    std::shared_ptr<ASTNode> expression = this->expression();
+
+    return std::make_shared<AwaitExpression>(std::make_shared<Token>(address),
+                                             std::move(expression));
+}
+
 std::shared_ptr<ASTNode> Parser::exprRender() {
     Token address = this->consume("render");
     bool newLine = false, errorStream = false;
@@ -395,15 +500,21 @@ std::shared_ptr<ASTNode> Parser::exprSize() {
 
 std::shared_ptr<ASTNode> Parser::exprLock() {
     Token address = this->consume("lock");
-    this->consume("(");
+    LockMode mode = LockMode::WRITE;
+
+    if(this->isNext("read", TokenCategory::IDENTIFIER)) {
+        this->consume("read");
+        mode = LockMode::READ;
+    }
 
+    this->consume("(");
     Token variable = this->getIdentifier();
     this->consume(")");
 
     std::shared_ptr<ASTNode> expression = this->expression();
     return std::make_shared<LockExpression>(std::make_shared<Token>(address),
                                             std::make_shared<Token>(variable),
-                                            std::move(expression));
+                                            std::move(expression), mode);
 }
 
 std::shared_ptr<ASTNode> Parser::exprType() {
@@ -534,6 +645,8 @@ std::shared_ptr<ASTNode> Parser::exprPrimary() {
         expression = this->exprSize();
     else if(this->isNext("parallel", TokenCategory::KEYWORD))
         expression = this->exprParallel();
+    else if(this->isNext("await", TokenCategory::KEYWORD))
+        expression = this->exprAwait();
     else if(this->isNext("lock", TokenCategory::KEYWORD))
         expression = this->exprLock();
     else if(this->isNext("val", TokenCategory::KEYWORD))
@@ -669,9 +782,25 @@ std::shared_ptr<ASTNode> Parser::exprEquality() {
           this->isNext("::", TokenCategory::OPERATOR) ||
           this->isNext("!:", TokenCategory::OPERATOR)) {
         Token op = this->consume(TokenCategory::OPERATOR);
-        expression = std::make_shared<BinaryExpression>(
-            std::make_shared<Token>(op), std::move(expression), op.getImage(),
-            this->exprComparison());
+        auto address = std::make_shared<Token>(op);
+        std::shared_ptr<ASTNode> right = this->exprComparison();
+
+        auto variable =
+            std::dynamic_pointer_cast<VariableAccessExpression>(expression);
+        auto access =
+            std::dynamic_pointer_cast<ArrayAccessExpression>(expression);
+
+        if(op.getImage() == "=" && variable)
+            expression = std::make_shared<AssignmentExpression>(
+                std::move(address), std::move(variable), std::move(right));
+        else if(op.getImage() == "=" && access)
+            expression = std::make_shared<ArrayAssignmentExpression>(
+                std::move(address), access->getArrayExpression(),
+                access->getIndexExpression(), std::move(right));
+        else
+            expression = std::make_shared<BinaryExpression>(
+                std::move(address), std::move(expression), op.getImage(),
+                std::move(right));
     }
 
     return expression;
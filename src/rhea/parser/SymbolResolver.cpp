@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <rhea/ast/expression/AssignmentExpression.hpp>
+#include <rhea/ast/expression/BlockExpression.hpp>
+#include <rhea/ast/expression/CatchHandleExpression.hpp>
+#include <rhea/ast/expression/FunctionCallExpression.hpp>
+#include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+#include <rhea/ast/expression/GroupedExpression.hpp>
+#include <rhea/ast/expression/IfElseExpression.hpp>
+#include <rhea/ast/expression/ParallelLoopExpression.hpp>
+#include <rhea/ast/expression/RandomExpression.hpp>
+#include <rhea/ast/expression/SingleStatementExpression.hpp>
+#include <rhea/ast/expression/UnlessExpression.hpp>
+#include <rhea/ast/expression/VariableAccessExpression.hpp>
+#include <rhea/ast/expression/VariableDeclarationExpression.hpp>
+#include <rhea/ast/expression/WhenExpression.hpp>
+#include <rhea/ast/statement/EnumStatement.hpp>
+#include <rhea/ast/statement/ExpressionStatement.hpp>
+#include <rhea/ast/statement/ModStatement.hpp>
+#include <rhea/ast/statement/ReturnStatement.hpp>
+#include <rhea/parser/SymbolResolver.hpp>
+
+void SymbolResolver::resolve(
+    const std::vector<std::shared_ptr<ASTNode>>& statements,
+    SymbolTable& symbols, bool dynamic) {
+    SymbolResolver resolver(symbols, dynamic);
+    std::vector<std::string> names;
+
+    for(const auto& statement : statements)
+        SymbolResolver::collect(statement, names, names);
+    resolver.globals.insert(names.begin(), names.end());
+
+    for(const auto& statement : statements) resolver.resolveNode(statement);
+}
+
+void SymbolResolver::collect(const std::shared_ptr<ASTNode>& node,
+                             std::vector<std::string>& assigned,
+                             std::vector<std::string>& declared) {
+    ASTNode* raw = node.get();
+    if(dynamic_cast<FunctionDeclarationExpression*>(raw)) return;
+
+    // Names first assigned in a parallel loop body belong to its own scope.
+    if(auto* counted = dynamic_cast<ParallelLoopExpression*>(raw)) {
+        SymbolResolver::collect(counted->getInitial(), assigned, declared);
+        return;
+    }
+
+    if(auto* assignment = dynamic_cast<AssignmentExpression*>(raw))
+        assigned.push_back(assignment->getVariable()->getName().getImage());
+    else if(auto* declaration =
+                dynamic_cast<VariableDeclarationExpression*>(raw)) {
+        for(const auto& [key, value] : declaration->getDeclarations())
+            declared.push_back(key.getImage());
+    } else if(auto* enumStmt = dynamic_cast<EnumStatement*>(raw)) {
+        for(const auto& [key, value] : enumStmt->getList())
+            declared.push_back(enumStmt->getName()->getImage() + "." +
+                               key->getImage());
+    } else if(auto* modStmt = dynamic_cast<ModStatement*>(raw)) {
+        for(const auto& [key, value] : modStmt->getMembers())
+            declared.push_back(modStmt->getName()->getImage() + "." +
+                               key->getImage());
+    }
+
+    raw->forEachChild([&assigned, &declared](std::shared_ptr<ASTNode>& child) {
+        if(child) SymbolResolver::collect(child, assigned, declared);
+    });
+}
+
+void SymbolResolver::markTailCalls(const std::shared_ptr<ASTNode>& node) {
+    ASTNode* raw = node.get();
+
+    if(auto* call = dynamic_cast<FunctionCallExpression*>(raw))
+        call->setTailCall(true);
+    else if(auto* block = dynamic_cast<BlockExpression*>(raw)) {
+        const auto& statements = block->getStatements();
+        for(const auto& statement : statements)
+            if(dynamic_cast<ReturnStatement*>(statement.get()))
+                SymbolResolver::markTailCalls(statement);
+
+        if(!statements.empty())
+            SymbolResolver::markTailCalls(statements.back());
+    } else if(auto* retStmt = dynamic_cast<ReturnStatement*>(raw))
+        SymbolResolver::markTailCalls(retStmt->getExpression());
+    else if(auto* exprStmt = dynamic_cast<ExpressionStatement*>(raw))
+        SymbolResolver::markTailCalls(exprStmt->getExpression());
+    else if(auto* grouped = dynamic_cast<GroupedExpression*>(raw))
+        SymbolResolver::markTailCalls(grouped->getExpression());
+    else if(auto* single = dynamic_cast<SingleStatementExpression*>(raw))
+        SymbolResolver::markTailCalls(single->getStatement());
+    else if(auto* ifElse = dynamic_cast<IfElseExpression*>(raw)) {
+        SymbolResolver::markTailCalls(ifElse->getThenBranch());
+        SymbolResolver::markTailCalls(ifElse->getElseBranch());
+    } else if(auto* unless = dynamic_cast<UnlessExpression*>(raw)) {
+        SymbolResolver::markTailCalls(unless->getThenBranch());
+        SymbolResolver::markTailCalls(unless->getElseBranch());
+    } else if(auto* random = dynamic_cast<RandomExpression*>(raw)) {
+        SymbolResolver::markTailCalls(random->getThenBranch());
+        SymbolResolver::markTailCalls(random->getElseBranch());
+    } else if(auto* when = dynamic_cast<WhenExpression*>(raw)) {
+        for(const auto& [condition, branch] : when->getCases())
+            SymbolResolver::markTailCalls(branch);
+        SymbolResolver::markTailCalls(when->getDefaultCase());
+    }
+}
+
+bool SymbolResolver::isKnown(const std::string& name) {
+    for(const auto& scope : this->scopes)
+        if(std::find(scope.layout->begin(), scope.layout->end(), name) !=
+           scope.layout->end())
+            return true;
+
+    return this->globals.count(name) == 1 || this->symbols.hasSymbol(name);
+}
+
+SymbolAddress SymbolResolver::lookup(const std::string& name) {
+    for(size_t index = this->scopes.size(); index-- > 0;) {
+        const SymbolLayout& layout = *this->scopes[index].layout;
+        auto slot = std::find(layout.begin(), layout.end(), name);
+
+        if(slot == layout.end()) continue;
+        for(size_t inner = index + 1; inner < this->scopes.size(); inner++)
+            if(this->scopes[inner].function)
+                this->scopes[inner].capturing = true;
+
+        return {SymbolScope::LOCAL,
+                static_cast<uint32_t>(this->scopes.size() - index - 1),
+                static_cast<uint32_t>(slot - layout.begin())};
+    }
+
+    if(this->dynamic) return {};
+    return {SymbolScope::GLOBAL, 0, this->symbols.intern(name)};
+}
+
+void SymbolResolver::declare(SymbolLayout& layout,
+                             const std::shared_ptr<ASTNode>& body) {
+    std::vector<std::string> assigned, declared;
+    SymbolResolver::collect(body, assigned, declared);
+
+    // A `val` always declares in its own scope, shadowing any outer name. A
+    // plain assignment only declares when nothing outside holds the name.
+    for(const auto& name : declared)
+        if(std::find(layout.begin(), layout.end(), name) == layout.end())
+            layout.push_back(name);
+
+    for(const auto& name : assigned)
+        if(std::find(layout.begin(), layout.end(), name) == layout.end() &&
+           !this->isKnown(name))
+            layout.push_back(name);
+}
+
+void SymbolResolver::resolveNode(const std::shared_ptr<ASTNode>& node) {
+    ASTNode* raw = node.get();
+
+    if(auto* variable = dynamic_cast<VariableAccessExpression*>(raw))
+        variable->setSymbolAddress(
+            this->lookup(variable->getName().getImage()));
+    else if(dynamic_cast<FunctionDeclarationExpression*>(raw))
+        this->resolveFunction(raw);
+    else if(dynamic_cast<CatchHandleExpression*>(raw))
+        this->resolveCatchHandle(raw);
+    else if(dynamic_cast<ParallelLoopExpression*>(raw))
+        this->resolveParallelLoop(raw);
+    else {
+        if(auto* declaration =
+               dynamic_cast<VariableDeclarationExpression*>(raw)) {
+            std::vector<SymbolAddress> addresses;
+            for(const auto& [key, value] : declaration->getDeclarations())
+                addresses.push_back(this->lookup(key.getImage()));
+
+            declaration->setSymbolAddresses(std::move(addresses));
+        } else if(auto* assignment = dynamic_cast<AssignmentExpression*>(raw))
+            this->resolveNode(assignment->getVariable());
+
+        raw->forEachChild([this](std::shared_ptr<ASTNode>& child) {
+            if(child) this->resolveNode(child);
+        });
+    }
+}
+
+void SymbolResolver::resolveFunction(ASTNode* node) {
+    auto* function = static_cast<FunctionDeclarationExpression*>(node);
+    auto layout = std::make_shared<SymbolLayout>(*function->getLayout());
+    this->declare(*layout, function->getBody());
+
+    this->scopes.push_back({layout, true, false});
+    this->resolveNode(function->getBody());
+    SymbolResolver::markTailCalls(function->getBody());
+
+    function->setLayout(layout, this->scopes.back().capturing);
+    this->scopes.pop_back();
+}
+
+void SymbolResolver::resolveCatchHandle(ASTNode* node) {
+    auto* catchHandle = static_cast<CatchHandleExpression*>(node);
+    this->resolveNode(catchHandle->getCatchBlock());
+
+    this->scopes.push_back(
+        {std::make_shared<SymbolLayout>(
+             SymbolLayout{catchHandle->getHandler()->getImage()}),
+         false, false});
+    this->resolveNode(catchHandle->getHandleBlock());
+    this->scopes.pop_back();
+
+    if(catchHandle->getFinalBlock())
+        this->resolveNode(catchHandle->getFinalBlock());
+}
+
+void SymbolResolver::resolveParallelLoop(ASTNode* node) {
+    auto* counted = static_cast<ParallelLoopExpression*>(node);
+    this->resolveNode(counted->getInitial());
+    this->resolveNode(counted->getBound());
+    this->resolveNode(counted->getStep());
+
+    for(const auto& [op, variable] : counted->getReductions())
+        this->resolveNode(variable);
+
+    auto layout = std::make_shared<SymbolLayout>(*counted->getLayout());
+    this->declare(*layout, counted->getBody());
+
+    this->scopes.push_back({layout, false, false});
+    this->resolveNode(counted->getBody());
+    this->scopes.pop_back();
+
+    counted->setLayout(layout);
+}
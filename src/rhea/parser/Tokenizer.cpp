@@ -136,7 +136,7 @@ void Tokenizer::scan() {
                 this->index++;
                 column++;
 
-                str = RheaUtil::replaceEscapeSequences(std::move(str));
+                str = RheaUtil::replaceEscapeSequences(std::move(str), true);
                 this->tokens.push_back(Token(str, fileName, line, startColumn,
                                              TokenCategory::REGEX));
             } else {
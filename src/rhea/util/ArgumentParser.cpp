@@ -16,7 +16,6 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <Rhea.hpp>
 #include <algorithm>
 #include <iostream>
 #include <rhea/util/ArgumentParser.hpp>
@@ -58,6 +57,23 @@ bool ArgumentParser::hasParameter(const std::string& paramShort) const {
     });
 }
 
+std::string ArgumentParser::getParameterValue(
+    const std::string& paramShort) const {
+    std::string shortPrefix = "-" + paramShort + "=",
+                longPrefix = "--" + this->parameters.at(paramShort) + "=";
+
+    for(int i = 1; i < argCount; ++i) {
+        std::string arg = this->argValues[i];
+
+        if(arg.rfind(shortPrefix, 0) == 0)
+            return arg.substr(shortPrefix.size());
+        else if(arg.rfind(longPrefix, 0) == 0)
+            return arg.substr(longPrefix.size());
+    }
+
+    return "";
+}
+
 std::string ArgumentParser::getProgramFileName() const {
     return this->argValues[0];
 }
@@ -65,17 +81,17 @@ std::string ArgumentParser::getProgramFileName() const {
 std::vector<std::string> ArgumentParser::getInputFiles() const {
     std::vector<std::string> inputFiles;
 
-    parsync(int i = 1; i < argCount; ++i) {
+    for(int i = 1; i < argCount; ++i) {
         std::string arg = this->argValues[i];
 
         if(arg.rfind("--", 0) == 0) {
-            std::string paramLong = arg.substr(2);
+            std::string paramLong = arg.substr(2, arg.find('=') - 2);
             if(std::any_of(
                    this->parameters.begin(), this->parameters.end(),
                    [&](const auto& pair) { return pair.second == paramLong; }))
                 continue;
         } else if(arg[0] == '-') {
-            std::string paramShort = arg.substr(1);
+            std::string paramShort = arg.substr(1, arg.find('=') - 1);
             if(this->parameters.count(paramShort) == 1) continue;
         }
 
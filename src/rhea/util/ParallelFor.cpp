@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <limits>
+#include <mutex>
+#include <rhea/util/ParallelFor.hpp>
+#include <rhea/util/Render.hpp>
+#include <string>
+#include <vector>
+
+namespace RheaUtil {
+
+#ifdef RHEA_DEBUG
+static std::mutex sitesMtx;
+static std::vector<ParallelFor::Site*> sites;
+#endif
+
+ParallelFor::Site::Site(const char* _name, size_t _grain,
+                        size_t _minimumTrips)
+    : name(_name),
+      grain(_grain),
+      minimumTrips(_minimumTrips),
+      itemCost(0.0)
+#ifdef RHEA_DEBUG
+      ,
+      serialRuns(0),
+      parallelRuns(0),
+      iterations(0)
+#endif
+{
+#ifdef RHEA_DEBUG
+    std::lock_guard<std::mutex> lock(sitesMtx);
+    sites.push_back(this);
+#endif
+}
+
+double ParallelFor::getTeamCost() {
+    // Cheapest of a few empty regions: the fixed price of waking a team,
+    // in nanoseconds, that the work of a loop has to amortize.
+    static const double cost = []() {
+#ifdef _OPENMP
+        double best = std::numeric_limits<double>::max();
+
+        for(int i = 0; i < 8; ++i) {
+            auto start = std::chrono::steady_clock::now();
+
+#pragma omp parallel
+            {
+            }
+
+            std::chrono::duration<double, std::nano> elapsed =
+                std::chrono::steady_clock::now() - start;
+            best = std::min(best, elapsed.count());
+        }
+
+        return best;
+#else
+        return std::numeric_limits<double>::max();
+#endif
+    }();
+
+    return cost;
+}
+
+bool ParallelFor::shouldSplit(Site& site, size_t count) {
+#ifdef _OPENMP
+    if(Task::isRunning() || omp_in_parallel() || omp_get_max_threads() < 2 ||
+       count / site.grain < 2)
+        return false;
+
+    // Until a serial run has measured the per-item cost, stay serial.
+    double itemCost = site.itemCost.load(std::memory_order_relaxed);
+    return itemCost > 0.0 && itemCost * static_cast<double>(count) >
+                                 2.0 * ParallelFor::getTeamCost();
+#else
+    (void)site;
+    (void)count;
+
+    return false;
+#endif
+}
+
+void ParallelFor::record(Site& site, size_t count, size_t threads,
+                         std::chrono::steady_clock::duration elapsed) {
+#ifdef RHEA_DEBUG
+    (threads > 1 ? site.parallelRuns : site.serialRuns)++;
+    site.iterations += count;
+#endif
+
+    // A team run costs the team itself plus the serial time spread over its
+    // threads. Undo both so parallel runs keep the per-item estimate up to
+    // date, and a loop whose items got cheap drops back to serial.
+    double nanos = std::chrono::duration<double, std::nano>(elapsed).count();
+    if(threads > 1)
+        nanos = std::max(nanos - ParallelFor::getTeamCost(), 0.0) *
+                static_cast<double>(threads);
+
+    double sample = nanos / static_cast<double>(count),
+           previous = site.itemCost.load(std::memory_order_relaxed);
+
+    site.itemCost.store(
+        previous <= 0.0 ? sample : previous * 0.75 + sample * 0.25,
+        std::memory_order_relaxed);
+}
+
+void ParallelFor::report() {
+#ifdef RHEA_DEBUG
+    std::lock_guard<std::mutex> lock(sitesMtx);
+    std::string text;
+
+    for(const auto* site : sites)
+        if(site->serialRuns.load() + site->parallelRuns.load() != 0)
+            text += std::string(site->name) + ": " +
+                    std::to_string(site->serialRuns.load()) + " serial, " +
+                    std::to_string(site->parallelRuns.load()) +
+                    " parallel, " + std::to_string(site->iterations.load()) +
+                    " iterations, " +
+                    std::to_string(site->itemCost.load()) + " ns/item\r\n";
+
+    if(!text.empty())
+        RheaUtil::renderError("Team cost: " +
+                              std::to_string(ParallelFor::getTeamCost()) +
+                              " ns\r\n" + text);
+#endif
+}
+
+};  // namespace RheaUtil
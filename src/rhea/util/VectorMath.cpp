@@ -16,7 +16,7 @@
  * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
  */
 
-#include <Rhea.hpp>
+#include <rhea/util/ParallelFor.hpp>
 #include <rhea/util/VectorMath.hpp>
 
 namespace RheaUtil {
@@ -31,8 +31,9 @@ bool isNumberArray(std::vector<DynamicObject> vec) {
 DynamicObject vector2Object(const std::vector<double>& vec) {
     std::vector<DynamicObject> objects(vec.size());
 
-    parsync(size_t i = 0; i < vec.size(); ++i) objects[i] =
-        DynamicObject(vec[i]);
+    static ParallelFor::Site site("vector2Object");
+    ParallelFor::run(site, vec.size(),
+                     [&](size_t i) { objects[i] = DynamicObject(vec[i]); });
 
     return DynamicObject(
         std::make_shared<std::vector<DynamicObject>>(std::move(objects)));
@@ -43,8 +44,9 @@ std::vector<double> object2Vector(const DynamicObject object) {
     size_t objSize = objects.size();
 
     std::vector<double> values(objSize);
-    parsync(long i = 0; i < (long)objSize; ++i) values[(size_t)i] =
-        objects[(size_t)i].getNumber();
+    static ParallelFor::Site site("object2Vector");
+    ParallelFor::run(site, objSize,
+                     [&](size_t i) { values[i] = objects[i].getNumber(); });
 
     return values;
 }
@@ -56,7 +58,10 @@ std::vector<double> RheaUtil::VectorMath::add(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] = left[i] + right[i];
+    static ParallelFor::Site site("VectorMath::add");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = left[i] + right[i];
+    });
 
     return result;
 }
@@ -66,7 +71,10 @@ std::vector<double> RheaUtil::VectorMath::addSingle(double value,
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = array[i] + value;
+    static ParallelFor::Site site("VectorMath::addSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = array[i] + value;
+    });
 
     return result;
 }
@@ -78,7 +86,10 @@ std::vector<double> RheaUtil::VectorMath::sub(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] = left[i] - right[i];
+    static ParallelFor::Site site("VectorMath::sub");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = left[i] - right[i];
+    });
 
     return result;
 }
@@ -88,7 +99,10 @@ std::vector<double> RheaUtil::VectorMath::subSingle(double value,
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = array[i] - value;
+    static ParallelFor::Site site("VectorMath::subSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = array[i] - value;
+    });
 
     return result;
 }
@@ -100,7 +114,10 @@ std::vector<double> RheaUtil::VectorMath::div(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] = left[i] / right[i];
+    static ParallelFor::Site site("VectorMath::div");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = left[i] / right[i];
+    });
 
     return result;
 }
@@ -110,7 +127,10 @@ std::vector<double> RheaUtil::VectorMath::divSingle(double value,
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = array[i] / value;
+    static ParallelFor::Site site("VectorMath::divSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = array[i] / value;
+    });
 
     return result;
 }
@@ -122,7 +142,10 @@ std::vector<double> RheaUtil::VectorMath::mul(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] = left[i] * right[i];
+    static ParallelFor::Site site("VectorMath::mul");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = left[i] * right[i];
+    });
 
     return result;
 }
@@ -132,7 +155,10 @@ std::vector<double> RheaUtil::VectorMath::mulSingle(double value,
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = array[i] * value;
+    static ParallelFor::Site site("VectorMath::mulSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = array[i] * value;
+    });
 
     return result;
 }
@@ -144,8 +170,10 @@ std::vector<double> RheaUtil::VectorMath::rem(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] =
-        (double)((long)left[i] % (long)right[i]);
+    static ParallelFor::Site site("VectorMath::rem");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = (double)((long)left[i] % (long)right[i]);
+    });
 
     return result;
 }
@@ -155,8 +183,11 @@ std::vector<double> RheaUtil::VectorMath::remSingle(double value,
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = static_cast<double>(
-        static_cast<long>(array[i]) % static_cast<long>(value));
+    static ParallelFor::Site site("VectorMath::remSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = static_cast<double>(static_cast<long>(array[i]) %
+                                        static_cast<long>(value));
+    });
 
     return result;
 }
@@ -168,8 +199,10 @@ std::vector<double> RheaUtil::VectorMath::bitwiseAnd(
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] =
-        (double)((long)left[i] & (long)right[i]);
+    static ParallelFor::Site site("VectorMath::bitwiseAnd");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = (double)((long)left[i] & (long)right[i]);
+    });
 
     return result;
 }
@@ -179,8 +212,11 @@ std::vector<double> RheaUtil::VectorMath::bitwiseAndSingle(
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = static_cast<double>(
-        static_cast<long>(array[i]) & static_cast<long>(value));
+    static ParallelFor::Site site("VectorMath::bitwiseAndSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = static_cast<double>(static_cast<long>(array[i]) &
+                                        static_cast<long>(value));
+    });
 
     return result;
 }
@@ -192,8 +228,10 @@ std::vector<double> RheaUtil::VectorMath::bitwiseOr(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] =
-        (double)((long)left[i] | (long)right[i]);
+    static ParallelFor::Site site("VectorMath::bitwiseOr");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = (double)((long)left[i] | (long)right[i]);
+    });
 
     return result;
 }
@@ -203,8 +241,11 @@ std::vector<double> RheaUtil::VectorMath::bitwiseOrSingle(
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = static_cast<double>(
-        static_cast<long>(array[i]) | static_cast<long>(value));
+    static ParallelFor::Site site("VectorMath::bitwiseOrSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = static_cast<double>(static_cast<long>(array[i]) |
+                                        static_cast<long>(value));
+    });
 
     return result;
 }
@@ -216,8 +257,10 @@ std::vector<double> RheaUtil::VectorMath::bitwiseXor(
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] =
-        (double)((long)left[i] ^ (long)right[i]);
+    static ParallelFor::Site site("VectorMath::bitwiseXor");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = (double)((long)left[i] ^ (long)right[i]);
+    });
 
     return result;
 }
@@ -227,8 +270,11 @@ std::vector<double> RheaUtil::VectorMath::bitwiseXorSingle(
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = static_cast<double>(
-        static_cast<long>(array[i]) ^ static_cast<long>(value));
+    static ParallelFor::Site site("VectorMath::bitwiseXorSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = static_cast<double>(static_cast<long>(array[i]) ^
+                                        static_cast<long>(value));
+    });
 
     return result;
 }
@@ -240,8 +286,10 @@ std::vector<double> RheaUtil::VectorMath::shiftLeft(std::vector<double> left,
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] =
-        (double)((long)left[i] << (long)right[i]);
+    static ParallelFor::Site site("VectorMath::shiftLeft");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = (double)((long)left[i] << (long)right[i]);
+    });
 
     return result;
 }
@@ -251,8 +299,11 @@ std::vector<double> RheaUtil::VectorMath::shiftLeftSingle(
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = static_cast<double>(
-        static_cast<long>(array[i]) << static_cast<long>(value));
+    static ParallelFor::Site site("VectorMath::shiftLeftSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = static_cast<double>(static_cast<long>(array[i]) <<
+                                        static_cast<long>(value));
+    });
 
     return result;
 }
@@ -264,8 +315,10 @@ std::vector<double> RheaUtil::VectorMath::shiftRight(
         throw std::invalid_argument("Vectors must be of the same size.");
 
     std::vector<double> result(size);
-    parsync(size_t i = 0; i < size; ++i) result[i] =
-        (double)((long)left[i] >> (long)right[i]);
+    static ParallelFor::Site site("VectorMath::shiftRight");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = (double)((long)left[i] >> (long)right[i]);
+    });
 
     return result;
 }
@@ -275,8 +328,11 @@ std::vector<double> RheaUtil::VectorMath::shiftRightSingle(
     size_t size = array.size();
     std::vector<double> result(size);
 
-    parsync(size_t i = 0; i < size; ++i) result[i] = static_cast<double>(
-        static_cast<long>(array[i]) >> static_cast<long>(value));
+    static ParallelFor::Site site("VectorMath::shiftRightSingle");
+    ParallelFor::run(site, size, [&](size_t i) {
+        result[i] = static_cast<double>(static_cast<long>(array[i]) >>
+                                        static_cast<long>(value));
+    });
 
     return result;
 }
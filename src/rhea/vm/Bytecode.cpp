@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/vm/Bytecode.hpp>
+
+uint32_t Bytecode::emit(std::shared_ptr<Token> address, Opcode opcode,
+                        uint32_t a, uint32_t b, uint32_t c) {
+    this->instructions.push_back({opcode, a, b, c});
+    this->addresses.push_back(std::move(address));
+
+    return static_cast<uint32_t>(this->instructions.size() - 1);
+}
+
+void Bytecode::patch(uint32_t index, uint32_t target) {
+    this->instructions[index].b = target;
+}
+
+uint32_t Bytecode::position() const {
+    return static_cast<uint32_t>(this->instructions.size());
+}
+
+uint32_t Bytecode::addConstant(DynamicObject value) {
+    this->constants.push_back(std::move(value));
+    return static_cast<uint32_t>(this->constants.size() - 1);
+}
+
+uint32_t Bytecode::addName(const Token& name, SymbolAddress address) {
+    this->names.push_back(std::make_shared<Token>(name));
+    this->symbolAddresses.push_back(address);
+
+    return static_cast<uint32_t>(this->names.size() - 1);
+}
+
+uint32_t Bytecode::addNode(std::shared_ptr<ASTNode> node) {
+    this->nodes.push_back(std::move(node));
+    return static_cast<uint32_t>(this->nodes.size() - 1);
+}
+
+void Bytecode::addHandler(Handler handler) {
+    this->handlers.push_back(handler);
+}
+
+void Bytecode::reserveRegisters(uint32_t count) {
+    this->registerCount = std::max(this->registerCount, count);
+}
+
+void Bytecode::setLocals(std::shared_ptr<const SymbolLayout> layout) {
+    this->locals = std::move(layout);
+}
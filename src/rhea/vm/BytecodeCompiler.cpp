@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <rhea/ast/expression/ArrayAccessExpression.hpp>
+#include <rhea/ast/expression/ArrayAssignmentExpression.hpp>
+#include <rhea/ast/expression/ArrayExpression.hpp>
+#include <rhea/ast/expression/AssignmentExpression.hpp>
+#include <rhea/ast/expression/BinaryExpression.hpp>
+#include <rhea/ast/expression/BlockExpression.hpp>
+#include <rhea/ast/expression/BooleanLiteralExpression.hpp>
+#include <rhea/ast/expression/FunctionCallExpression.hpp>
+#include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+#include <rhea/ast/expression/GroupedExpression.hpp>
+#include <rhea/ast/expression/IfElseExpression.hpp>
+#include <rhea/ast/expression/LoopExpression.hpp>
+#include <rhea/ast/expression/NilCoalescingExpression.hpp>
+#include <rhea/ast/expression/NilLiteralExpression.hpp>
+#include <rhea/ast/expression/NumberLiteralExpression.hpp>
+#include <rhea/ast/expression/RenderExpression.hpp>
+#include <rhea/ast/expression/StringLiteralExpression.hpp>
+#include <rhea/ast/expression/UnaryExpression.hpp>
+#include <rhea/ast/expression/UnlessExpression.hpp>
+#include <rhea/ast/expression/VariableAccessExpression.hpp>
+#include <rhea/ast/expression/VariableDeclarationExpression.hpp>
+#include <rhea/ast/expression/WhenExpression.hpp>
+#include <rhea/ast/expression/WhileExpression.hpp>
+#include <rhea/ast/statement/BreakStatement.hpp>
+#include <rhea/ast/statement/ContinueStatement.hpp>
+#include <rhea/ast/statement/EmptyStatement.hpp>
+#include <rhea/ast/statement/ExpressionStatement.hpp>
+#include <rhea/ast/statement/ReturnStatement.hpp>
+#include <rhea/vm/BytecodeCompiler.hpp>
+
+static Opcode binaryOpcode(BinaryOperator op) {
+    switch(op) {
+        case BinaryOperator::ADD:
+            return Opcode::ADD;
+        case BinaryOperator::SUB:
+            return Opcode::SUB;
+        case BinaryOperator::MUL:
+            return Opcode::MUL;
+        case BinaryOperator::DIV:
+            return Opcode::DIV;
+        case BinaryOperator::RDIV:
+            return Opcode::RDIV;
+        case BinaryOperator::MOD:
+            return Opcode::MOD;
+        case BinaryOperator::BIT_AND:
+            return Opcode::BIT_AND;
+        case BinaryOperator::BIT_OR:
+            return Opcode::BIT_OR;
+        case BinaryOperator::BIT_XOR:
+            return Opcode::BIT_XOR;
+        case BinaryOperator::SHIFT_LEFT:
+            return Opcode::SHIFT_LEFT;
+        case BinaryOperator::SHIFT_RIGHT:
+            return Opcode::SHIFT_RIGHT;
+        case BinaryOperator::LOGIC_AND:
+            return Opcode::LOGIC_AND;
+        case BinaryOperator::LOGIC_OR:
+            return Opcode::LOGIC_OR;
+        case BinaryOperator::EQUAL:
+            return Opcode::EQUAL;
+        case BinaryOperator::NOT_EQUAL:
+            return Opcode::NOT_EQUAL;
+        case BinaryOperator::LESS:
+            return Opcode::LESS;
+        case BinaryOperator::GREATER:
+            return Opcode::GREATER;
+        case BinaryOperator::LESS_EQUAL:
+            return Opcode::LESS_EQUAL;
+        case BinaryOperator::GREATER_EQUAL:
+            return Opcode::GREATER_EQUAL;
+
+        case BinaryOperator::ASSIGN:
+        case BinaryOperator::NIL_COALESCE:
+        case BinaryOperator::REGEX_MATCH:
+        case BinaryOperator::REGEX_NOT_MATCH:
+        case BinaryOperator::VECTOR_ADD:
+        case BinaryOperator::VECTOR_SUB:
+        case BinaryOperator::VECTOR_MUL:
+        case BinaryOperator::VECTOR_DIV:
+        case BinaryOperator::VECTOR_REM:
+        case BinaryOperator::VECTOR_BIT_AND:
+        case BinaryOperator::VECTOR_BIT_OR:
+        case BinaryOperator::VECTOR_BIT_XOR:
+        case BinaryOperator::VECTOR_SHIFT_LEFT:
+        case BinaryOperator::VECTOR_SHIFT_RIGHT:
+        default:
+            return Opcode::BINARY;
+    }
+}
+
+std::shared_ptr<Bytecode> BytecodeCompiler::compile(
+    const std::vector<std::shared_ptr<ASTNode>>& statements) {
+    BytecodeCompiler compiler;
+    uint32_t result = compiler.allocate();
+
+    compiler.bytecode->emit(nullptr, Opcode::LOAD_NIL, result);
+    for(const auto& statement : statements)
+        compiler.compileNode(statement, result);
+    compiler.bytecode->emit(nullptr, Opcode::RETURN, result);
+
+    return compiler.bytecode;
+}
+
+std::shared_ptr<Bytecode> BytecodeCompiler::compile(
+    const std::shared_ptr<ASTNode>& body) {
+    BytecodeCompiler compiler;
+    uint32_t result = compiler.allocate();
+
+    compiler.compileNode(body, result);
+    compiler.bytecode->emit(nullptr, Opcode::RETURN, result);
+
+    return compiler.bytecode;
+}
+
+std::shared_ptr<Bytecode> BytecodeCompiler::compile(
+    const std::shared_ptr<ASTNode>& body,
+    std::shared_ptr<const SymbolLayout> layout, uint32_t parameters) {
+    BytecodeCompiler compiler;
+    compiler.locals = static_cast<uint32_t>(layout->size());
+    compiler.parameters = parameters;
+
+    compiler.allocate(compiler.locals);
+    uint32_t result = compiler.allocate();
+
+    compiler.compileNode(body, result);
+    compiler.bytecode->emit(nullptr, Opcode::RETURN, result);
+
+    // Anything that sees the frame itself (tree-walked nodes, closures)
+    // needs the locals in the symbol table, so such bodies keep one.
+    if(compiler.framed) return nullptr;
+
+    compiler.bytecode->setLocals(std::move(layout));
+    return compiler.bytecode;
+}
+
+uint32_t BytecodeCompiler::allocate(uint32_t count) {
+    uint32_t base = this->top;
+
+    this->top += count;
+    this->bytecode->reserveRegisters(this->top);
+
+    return base;
+}
+
+void BytecodeCompiler::release(uint32_t mark) {
+    this->top = mark;
+}
+
+bool BytecodeCompiler::isRegister(const SymbolAddress& address) const {
+    return address.scope == SymbolScope::LOCAL && address.depth == 0 &&
+           address.slot < this->locals;
+}
+
+void BytecodeCompiler::compileNode(const std::shared_ptr<ASTNode>& node,
+                                   uint32_t target) {
+    ASTNode* raw = node.get();
+    const std::shared_ptr<Token>& address = node->getAddress();
+
+    if(auto* number = dynamic_cast<NumberLiteralExpression*>(raw))
+        this->bytecode->emit(
+            address, Opcode::LOAD_CONST, target,
+            this->bytecode->addConstant(DynamicObject(number->getValue())));
+    else if(auto* str = dynamic_cast<StringLiteralExpression*>(raw))
+        this->bytecode->emit(
+            address, Opcode::LOAD_CONST, target,
+            this->bytecode->addConstant(DynamicObject(str->getValue())));
+    else if(auto* boolean = dynamic_cast<BooleanLiteralExpression*>(raw))
+        this->bytecode->emit(address, Opcode::LOAD_BOOL, target,
+                             boolean->getValue() ? 1 : 0);
+    else if(dynamic_cast<NilLiteralExpression*>(raw) ||
+            dynamic_cast<EmptyStatement*>(raw))
+        this->bytecode->emit(address, Opcode::LOAD_NIL, target);
+    else if(auto* grouped = dynamic_cast<GroupedExpression*>(raw))
+        this->compileNode(grouped->getExpression(), target);
+    else if(auto* exprStmt = dynamic_cast<ExpressionStatement*>(raw))
+        this->compileNode(exprStmt->getExpression(), target);
+    else if(auto* variable = dynamic_cast<VariableAccessExpression*>(raw)) {
+        const SymbolAddress& symbol = variable->getSymbolAddress();
+
+        if(!this->isRegister(symbol))
+            this->bytecode->emit(
+                address, Opcode::GET_SYMBOL, target,
+                this->bytecode->addName(variable->getName(), symbol));
+        else if(symbol.slot < this->parameters)
+            this->bytecode->emit(address, Opcode::MOVE, target, symbol.slot);
+        else
+            this->bytecode->emit(
+                address, Opcode::GET_LOCAL, target, symbol.slot,
+                this->bytecode->addName(variable->getName(), symbol));
+    }
+    else if(dynamic_cast<VariableDeclarationExpression*>(raw))
+        this->compileDeclaration(node, target);
+    else if(dynamic_cast<AssignmentExpression*>(raw))
+        this->compileAssignment(raw, target);
+    else if(dynamic_cast<ArrayAssignmentExpression*>(raw))
+        this->compileArrayAssignment(raw, target);
+    else if(dynamic_cast<BinaryExpression*>(raw))
+        this->compileBinary(raw, target);
+    else if(dynamic_cast<UnaryExpression*>(raw))
+        this->compileUnary(raw, target);
+    else if(auto* coalesce = dynamic_cast<NilCoalescingExpression*>(raw)) {
+        this->compileNode(coalesce->getLeft(), target);
+
+        uint32_t jump =
+            this->bytecode->emit(address, Opcode::JUMP_IF_NOT_NIL, target);
+        this->compileNode(coalesce->getRight(), target);
+        this->bytecode->patch(jump, this->bytecode->position());
+    } else if(dynamic_cast<BlockExpression*>(raw))
+        this->compileBlock(raw, target);
+    else if(auto* ifElse = dynamic_cast<IfElseExpression*>(raw))
+        this->compileConditional(address, ifElse->getCondition(),
+                                 ifElse->getThenBranch(),
+                                 ifElse->getElseBranch(), false, target);
+    else if(auto* unless = dynamic_cast<UnlessExpression*>(raw))
+        this->compileConditional(address, unless->getCondition(),
+                                 unless->getThenBranch(),
+                                 unless->getElseBranch(), true, target);
+    else if(auto* whileExpr = dynamic_cast<WhileExpression*>(raw))
+        this->compileLoop(address, nullptr, whileExpr->getCondition(), nullptr,
+                          whileExpr->getBody(), target);
+    else if(auto* loop = dynamic_cast<LoopExpression*>(raw))
+        this->compileLoop(address, loop->getInitial(), loop->getCondition(),
+                          loop->getPostExpression(), loop->getBody(), target);
+    else if(dynamic_cast<WhenExpression*>(raw))
+        this->compileWhen(raw, target);
+    else if(auto* array = dynamic_cast<ArrayExpression*>(raw)) {
+        uint32_t mark = this->top;
+        uint32_t count = static_cast<uint32_t>(array->getElements().size());
+        uint32_t base = this->allocate(count);
+
+        for(uint32_t i = 0; i < count; i++)
+            this->compileNode(array->getElements()[i], base + i);
+
+        this->bytecode->emit(address, Opcode::NEW_ARRAY, target, base, count);
+        this->release(mark);
+    } else if(auto* access = dynamic_cast<ArrayAccessExpression*>(raw)) {
+        uint32_t mark = this->top, index = this->allocate();
+
+        this->compileNode(access->getArrayExpression(), target);
+        this->compileNode(access->getIndexExpression(), index);
+        this->bytecode->emit(address, Opcode::GET_INDEX, target, target,
+                             index);
+        this->release(mark);
+    } else if(dynamic_cast<FunctionCallExpression*>(raw))
+        this->compileCall(raw, target);
+    else if(dynamic_cast<FunctionDeclarationExpression*>(raw))
+        this->compileFunction(raw, target);
+    else if(auto* render = dynamic_cast<RenderExpression*>(raw)) {
+        this->compileNode(render->getExpression(), target);
+        this->bytecode->emit(address, Opcode::RENDER, target,
+                             (render->isNewLine() ? 1u : 0u) |
+                                 (render->isErrorStream() ? 2u : 0u));
+    } else if(auto* ret = dynamic_cast<ReturnStatement*>(raw)) {
+        if(this->blocks.empty()) {
+            this->compileNode(ret->getExpression(), target);
+            this->bytecode->emit(address, Opcode::SIGNAL_RETURN, target);
+            return;
+        }
+
+        BlockContext& block = this->blocks.back();
+        this->compileNode(ret->getExpression(), block.reg);
+        block.returnJumps.push_back(
+            this->bytecode->emit(address, Opcode::JUMP, 0));
+    } else if(dynamic_cast<BreakStatement*>(raw)) {
+        if(this->loops.empty())
+            this->bytecode->emit(address, Opcode::SIGNAL_BREAK, target);
+        else
+            this->loops.back().breakJumps.push_back(
+                this->bytecode->emit(address, Opcode::JUMP, 0));
+    } else if(dynamic_cast<ContinueStatement*>(raw)) {
+        if(this->loops.empty())
+            this->bytecode->emit(address, Opcode::SIGNAL_CONTINUE, target);
+        else
+            this->loops.back().continueJumps.push_back(
+                this->bytecode->emit(address, Opcode::JUMP, 0));
+    } else
+        this->compileFallback(node, target);
+}
+
+void BytecodeCompiler::compileFallback(const std::shared_ptr<ASTNode>& node,
+                                       uint32_t target) {
+    this->framed = true;
+    this->bytecode->emit(node->getAddress(), Opcode::EVAL, target,
+                         this->bytecode->addNode(node));
+}
+
+void BytecodeCompiler::compileBinary(ASTNode* node, uint32_t target) {
+    auto* binary = static_cast<BinaryExpression*>(node);
+    const std::shared_ptr<Token>& address = binary->getAddress();
+    BinaryOperator op = binary->getOperator();
+    uint32_t mark = this->top;
+
+    uint32_t right = this->allocate();
+    this->compileNode(binary->getLeft(), target);
+    this->compileNode(binary->getRight(), right);
+
+    Opcode opcode = binaryOpcode(op);
+    if(opcode != Opcode::BINARY)
+        this->bytecode->emit(address, opcode, target, target, right);
+    else
+        this->bytecode->emit(address, Opcode::BINARY, target, right,
+                             static_cast<uint32_t>(op));
+
+    this->release(mark);
+}
+
+void BytecodeCompiler::compileAssignment(ASTNode* node, uint32_t target) {
+    auto* assignment = static_cast<AssignmentExpression*>(node);
+    const auto& variable = assignment->getVariable();
+
+    const SymbolAddress& symbol = variable->getSymbolAddress();
+
+    this->compileNode(assignment->getValue(), target);
+    if(this->isRegister(symbol))
+        this->bytecode->emit(assignment->getAddress(), Opcode::SET_LOCAL,
+                             target, symbol.slot);
+    else
+        this->bytecode->emit(
+            assignment->getAddress(), Opcode::SET_SYMBOL, target,
+            this->bytecode->addName(variable->getName(), symbol));
+}
+
+void BytecodeCompiler::compileArrayAssignment(ASTNode* node,
+                                              uint32_t target) {
+    auto* assignment = static_cast<ArrayAssignmentExpression*>(node);
+    const std::shared_ptr<Token>& address = assignment->getAddress();
+    uint32_t mark = this->top;
+    uint32_t array = this->allocate(), index = this->allocate();
+
+    this->compileNode(assignment->getArrayExpression(), array);
+    this->compileNode(assignment->getIndexExpression(), index);
+    this->compileNode(assignment->getValue(), target);
+
+    this->bytecode->emit(address, Opcode::SET_INDEX, array, index, target);
+    this->bytecode->emit(address, Opcode::MOVE, target, array);
+    this->release(mark);
+}
+
+void BytecodeCompiler::compileUnary(ASTNode* node, uint32_t target) {
+    auto* unary = static_cast<UnaryExpression*>(node);
+    const std::shared_ptr<Token>& address = unary->getAddress();
+    UnaryOperator op = unary->getOperator();
+
+    this->compileNode(unary->getExpression(), target);
+    if(op == UnaryOperator::NOT)
+        this->bytecode->emit(address, Opcode::NOT, target, target);
+    else if(op == UnaryOperator::NEGATE)
+        this->bytecode->emit(address, Opcode::NEGATE, target, target);
+    else
+        this->bytecode->emit(address, Opcode::UNARY, target, target,
+                             static_cast<uint32_t>(op));
+}
+
+void BytecodeCompiler::compileBlock(ASTNode* node, uint32_t target) {
+    auto* block = static_cast<BlockExpression*>(node);
+    uint32_t start = this->bytecode->position();
+
+    this->blocks.push_back({target, {}});
+    this->bytecode->emit(block->getAddress(), Opcode::LOAD_NIL, target);
+
+    for(const auto& statement : block->getStatements())
+        this->compileNode(statement, target);
+
+    uint32_t end = this->bytecode->position();
+    for(uint32_t jump : this->blocks.back().returnJumps)
+        this->bytecode->patch(jump, end);
+
+    this->blocks.pop_back();
+    this->bytecode->addHandler(
+        {HandlerType::BLOCK, start, end, end, 0, target});
+}
+
+void BytecodeCompiler::compileConditional(
+    const std::shared_ptr<Token>& address,
+    const std::shared_ptr<ASTNode>& condition,
+    const std::shared_ptr<ASTNode>& thenBranch,
+    const std::shared_ptr<ASTNode>& elseBranch, bool negate, uint32_t target) {
+    this->compileNode(condition, target);
+
+    uint32_t elseJump = this->bytecode->emit(
+        address, negate ? Opcode::JUMP_IF_TRUE : Opcode::JUMP_IF_FALSE, target);
+    this->compileNode(thenBranch, target);
+
+    uint32_t endJump = this->bytecode->emit(address, Opcode::JUMP, 0);
+    this->bytecode->patch(elseJump, this->bytecode->position());
+
+    if(elseBranch)
+        this->compileNode(elseBranch, target);
+    else
+        this->bytecode->emit(address, Opcode::LOAD_NIL, target);
+
+    this->bytecode->patch(endJump, this->bytecode->position());
+}
+
+void BytecodeCompiler::compileLoop(const std::shared_ptr<Token>& address,
+                                   const std::shared_ptr<ASTNode>& initial,
+                                   const std::shared_ptr<ASTNode>& condition,
+                                   const std::shared_ptr<ASTNode>& postexpr,
+                                   const std::shared_ptr<ASTNode>& body,
+                                   uint32_t target) {
+    uint32_t mark = this->top, temp = this->allocate();
+
+    if(initial) this->compileNode(initial, temp);
+    this->bytecode->emit(address, Opcode::LOAD_NIL, target);
+
+    uint32_t start = this->bytecode->position();
+    this->compileNode(condition, temp);
+
+    uint32_t exitJump =
+        this->bytecode->emit(address, Opcode::JUMP_IF_FALSE, temp);
+    uint32_t bodyStart = this->bytecode->position();
+
+    this->loops.push_back({0, {}, {}});
+    this->compileNode(body, temp);
+    this->bytecode->emit(address, Opcode::MOVE, target, temp);
+
+    uint32_t bodyEnd = this->bytecode->position();
+    uint32_t continueTarget = start;
+
+    if(postexpr) {
+        continueTarget = bodyEnd;
+        this->compileNode(postexpr, temp);
+    }
+
+    this->bytecode->emit(address, Opcode::JUMP, 0, start);
+
+    uint32_t end = this->bytecode->position();
+    this->bytecode->patch(exitJump, end);
+
+    for(uint32_t jump : this->loops.back().breakJumps)
+        this->bytecode->patch(jump, end);
+    for(uint32_t jump : this->loops.back().continueJumps)
+        this->bytecode->patch(jump, continueTarget);
+
+    this->loops.pop_back();
+    this->bytecode->addHandler(
+        {HandlerType::LOOP, bodyStart, bodyEnd, end, continueTarget, 0});
+    this->release(mark);
+}
+
+void BytecodeCompiler::compileWhen(ASTNode* node, uint32_t target) {
+    auto* when = static_cast<WhenExpression*>(node);
+    const std::shared_ptr<Token>& address = when->getAddress();
+
+    uint32_t mark = this->top, value = this->allocate(),
+             test = this->allocate();
+    std::vector<uint32_t> endJumps;
+
+    this->compileNode(when->getExpression(), value);
+    for(const auto& [caseValue, caseBody] : when->getCases()) {
+        this->compileNode(caseValue, test);
+        this->bytecode->emit(address, Opcode::EQUAL, test, test, value);
+
+        uint32_t nextJump =
+            this->bytecode->emit(address, Opcode::JUMP_IF_FALSE, test);
+        this->compileNode(caseBody, target);
+
+        endJumps.push_back(this->bytecode->emit(address, Opcode::JUMP, 0));
+        this->bytecode->patch(nextJump, this->bytecode->position());
+    }
+
+    if(when->getDefaultCase())
+        this->compileNode(when->getDefaultCase(), target);
+    else
+        this->bytecode->emit(address, Opcode::LOAD_NIL, target);
+
+    for(uint32_t jump : endJumps)
+        this->bytecode->patch(jump, this->bytecode->position());
+
+    this->release(mark);
+}
+
+void BytecodeCompiler::compileCall(ASTNode* node, uint32_t target) {
+    auto* call = static_cast<FunctionCallExpression*>(node);
+    const auto& arguments = call->getArguments();
+
+    uint32_t mark = this->top;
+    uint32_t count = static_cast<uint32_t>(arguments.size());
+    uint32_t base = this->allocate(count + 1);
+
+    this->compileNode(call->getCallable(), base);
+    for(uint32_t i = 0; i < count; i++)
+        this->compileNode(arguments[i], base + i + 1);
+
+    this->bytecode->emit(call->getAddress(),
+                         call->isTailCall() ? Opcode::TAIL_CALL : Opcode::CALL,
+                         target, base, count);
+    this->release(mark);
+}
+
+void BytecodeCompiler::compileFunction(ASTNode* node, uint32_t target) {
+    auto* function = static_cast<FunctionDeclarationExpression*>(node);
+    auto prototype = std::make_shared<FunctionDeclarationExpression>(
+        function->getAddress(), function->getParameters(),
+        function->getBody());
+
+    std::shared_ptr<Bytecode> body = nullptr;
+    if(!function->isCapturing())
+        body = BytecodeCompiler::compile(
+            function->getBody(), function->getLayout(),
+            static_cast<uint32_t>(function->getParameters().size()));
+
+    prototype->setLayout(function->getLayout(), function->isCapturing());
+    prototype->setBytecode(body ? std::move(body)
+                                : BytecodeCompiler::compile(
+                                      function->getBody()));
+
+    if(function->isCapturing()) this->framed = true;
+    this->bytecode->emit(
+        function->getAddress(),
+        function->isCapturing() ? Opcode::CLOSURE : Opcode::LOAD_CONST, target,
+        this->bytecode->addConstant(DynamicObject(std::move(prototype))));
+}
+
+void BytecodeCompiler::compileDeclaration(const std::shared_ptr<ASTNode>& node,
+                                          uint32_t target) {
+    auto* declaration = static_cast<VariableDeclarationExpression*>(node.get());
+    if(!declaration->getNativePath().empty()) {
+        this->compileFallback(node, target);
+        return;
+    }
+
+    size_t index = 0;
+    for(const auto& [key, value] : declaration->getDeclarations()) {
+        const SymbolAddress& symbol =
+            declaration->getSymbolAddresses()[index++];
+
+        this->compileNode(value.second, target);
+        if(this->isRegister(symbol))
+            this->bytecode->emit(declaration->getAddress(), Opcode::SET_LOCAL,
+                                 target, symbol.slot);
+        else
+            this->bytecode->emit(declaration->getAddress(),
+                                 Opcode::SET_SYMBOL, target,
+                                 this->bytecode->addName(key, symbol));
+    }
+
+    this->bytecode->emit(declaration->getAddress(), Opcode::LOAD_NIL, target);
+}
@@ -0,0 +1,480 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <memory>
+#include <rhea/ast/ASTNodeException.hpp>
+#include <rhea/ast/Completion.hpp>
+#include <rhea/ast/TailCall.hpp>
+#include <rhea/ast/expression/ArrayAccessExpression.hpp>
+#include <rhea/ast/expression/ArrayAssignmentExpression.hpp>
+#include <rhea/ast/expression/BinaryExpression.hpp>
+#include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+#include <rhea/ast/expression/UnaryExpression.hpp>
+#include <rhea/core/CallFrame.hpp>
+#include <rhea/core/NativeBinding.hpp>
+#include <rhea/core/Runtime.hpp>
+#include <rhea/util/Render.hpp>
+#include <rhea/vm/VirtualMachine.hpp>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RHEA_VM_COMPUTED_GOTO
+#endif
+
+thread_local std::vector<std::vector<DynamicObject>>
+    VirtualMachine::RegisterFile::pool;
+thread_local std::vector<std::vector<uint8_t>>
+    VirtualMachine::RegisterFile::boundPool;
+
+VirtualMachine::RegisterFile::RegisterFile(uint32_t count, uint32_t locals)
+    : registers(), bound() {
+    if(!RegisterFile::pool.empty()) {
+        this->registers = std::move(RegisterFile::pool.back());
+        RegisterFile::pool.pop_back();
+    }
+
+    if(locals != 0 && !RegisterFile::boundPool.empty()) {
+        this->bound = std::move(RegisterFile::boundPool.back());
+        RegisterFile::boundPool.pop_back();
+    }
+
+    this->registers.resize(count);
+    this->bound.resize(locals, 0);
+}
+
+VirtualMachine::RegisterFile::~RegisterFile() {
+    this->registers.clear();
+    RegisterFile::pool.push_back(std::move(this->registers));
+
+    if(this->bound.capacity() == 0) return;
+    this->bound.clear();
+    RegisterFile::boundPool.push_back(std::move(this->bound));
+}
+
+DynamicObject* VirtualMachine::RegisterFile::data() {
+    return this->registers.data();
+}
+
+uint8_t* VirtualMachine::RegisterFile::flags() {
+    return this->bound.data();
+}
+
+void VirtualMachine::RegisterFile::store(SymbolTable& frame) {
+    for(uint32_t slot = 0; slot < this->bound.size(); slot++)
+        if(this->bound[slot] != 0)
+            frame.setSymbol(nullptr, {SymbolScope::LOCAL, 0, slot},
+                            this->registers[slot]);
+}
+
+void VirtualMachine::RegisterFile::load(const SymbolTable& frame) {
+    for(uint32_t slot = 0; slot < this->bound.size(); slot++)
+        this->bound[slot] =
+            frame.findLocal(slot, this->registers[slot]) ? 1 : 0;
+}
+
+const Handler* VirtualMachine::findHandler(const Bytecode& bytecode,
+                                           HandlerType type,
+                                           uint32_t position) {
+    for(const auto& handler : bytecode.getHandlers())
+        if(handler.type == type && position >= handler.start &&
+           position < handler.end)
+            return &handler;
+
+    return nullptr;
+}
+
+bool VirtualMachine::resume(const Bytecode& bytecode, uint32_t position,
+                            DynamicObject* reg, uint32_t& target) {
+    CompletionType kind = Completion::current();
+    const Handler* handler = VirtualMachine::findHandler(
+        bytecode,
+        kind == CompletionType::RETURN ? HandlerType::BLOCK
+                                       : HandlerType::LOOP,
+        position);
+    if(handler == nullptr) return false;
+
+    Completion::consume(kind);
+    switch(kind) {
+        case CompletionType::CONTINUE:
+            target = handler->continueTarget;
+            break;
+
+        case CompletionType::RETURN:
+            reg[handler->reg] = reg[bytecode.getInstructions()[position].a];
+            target = handler->target;
+            break;
+
+        case CompletionType::BREAK:
+        case CompletionType::NORMAL:
+        default:
+            target = handler->target;
+            break;
+    }
+
+    return true;
+}
+
+#ifdef RHEA_VM_COMPUTED_GOTO
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+DynamicObject VirtualMachine::execute(
+    const Bytecode& bytecode, SymbolTable& symbols,
+    const std::vector<DynamicObject>& arguments) {
+    const auto& locals = bytecode.getLocals();
+    RegisterFile registers(bytecode.getRegisterCount(),
+                           locals ? static_cast<uint32_t>(locals->size()) : 0);
+    DynamicObject* reg = registers.data();
+    uint8_t* bound = registers.flags();
+
+    for(size_t i = 0; i < arguments.size(); i++) {
+        reg[i] = arguments[i];
+        bound[i] = 1;
+    }
+
+    const Instruction* code = bytecode.getInstructions().data();
+    const Instruction* ip = code;
+
+#ifdef RHEA_VM_COMPUTED_GOTO
+    static const void* dispatchTable[] = {
+#define RHEA_VM_OPCODE_LABEL(name) &&op_##name,
+        RHEA_VM_OPCODES(RHEA_VM_OPCODE_LABEL)
+#undef RHEA_VM_OPCODE_LABEL
+    };
+
+#define VM_DISPATCH() goto* dispatchTable[static_cast<uint8_t>(ip->opcode)]
+#define VM_CASE(name) op_##name:
+#else
+#define VM_DISPATCH() goto dispatch
+#define VM_CASE(name) case Opcode::name:
+#endif
+
+#ifdef RHEA_VM_COMPUTED_GOTO
+#define VM_FALLTHROUGH()
+#else
+#define VM_FALLTHROUGH() [[fallthrough]]
+#endif
+
+#define VM_NEXT() \
+    ++ip;         \
+    VM_DISPATCH()
+#define VM_ADDRESS() bytecode.getAddress(static_cast<size_t>(ip - code))
+#define VM_POSITION() static_cast<uint32_t>(ip - code)
+
+#define VM_COMPLETE()                                                     \
+    if(Completion::isAbrupt()) {                                          \
+        uint32_t target = 0;                                              \
+        if(!VirtualMachine::resume(bytecode, VM_POSITION(), reg, target)) \
+            return reg[ip->a];                                            \
+        ip = code + target;                                               \
+        VM_DISPATCH();                                                    \
+    }
+
+#define VM_BINARY(name, expr) \
+    VM_CASE(name) {           \
+        reg[ip->a] = (expr);  \
+        VM_NEXT();            \
+    }
+
+#define VM_NUMERIC(name, op)                                       \
+    VM_CASE(name) {                                                \
+        DynamicObject &lhs = reg[ip->b], &rhs = reg[ip->c];        \
+        if(lhs.isNumber() && rhs.isNumber())                       \
+            reg[ip->a] =                                           \
+                DynamicObject(lhs.getNumber() op rhs.getNumber()); \
+        else                                                       \
+            reg[ip->a] = lhs op rhs;                               \
+        VM_NEXT();                                                 \
+    }
+
+#ifdef RHEA_VM_COMPUTED_GOTO
+    VM_DISPATCH();
+#else
+dispatch:
+    switch(ip->opcode) {
+#endif
+        VM_CASE(NOP) {
+            VM_NEXT();
+        }
+
+        VM_CASE(LOAD_NIL) {
+            reg[ip->a] = DynamicObject();
+            VM_NEXT();
+        }
+
+        VM_CASE(LOAD_BOOL) {
+            reg[ip->a] = DynamicObject(ip->b != 0);
+            VM_NEXT();
+        }
+
+        VM_CASE(LOAD_CONST) {
+            reg[ip->a] = bytecode.getConstant(ip->b);
+            VM_NEXT();
+        }
+
+        VM_CASE(CLOSURE) {
+            reg[ip->a] = DynamicObject(
+                bytecode.getConstant(ip->b).getCallable()->bind(symbols));
+            VM_NEXT();
+        }
+
+        VM_CASE(MOVE) {
+            reg[ip->a] = reg[ip->b];
+            VM_NEXT();
+        }
+
+        VM_CASE(GET_SYMBOL) {
+            reg[ip->a] = symbols.getSymbol(
+                bytecode.getName(ip->b), bytecode.getSymbolAddress(ip->b));
+            VM_NEXT();
+        }
+
+        VM_CASE(SET_SYMBOL) {
+            symbols.setSymbol(bytecode.getName(ip->b),
+                              bytecode.getSymbolAddress(ip->b), reg[ip->a]);
+            VM_NEXT();
+        }
+
+        VM_CASE(GET_LOCAL) {
+            if(bound[ip->b] == 0)
+                throw ASTNodeException(
+                    bytecode.getName(ip->c),
+                    "Cannot resolve symbol: " +
+                        bytecode.getName(ip->c)->getImage());
+
+            reg[ip->a] = reg[ip->b];
+            VM_NEXT();
+        }
+
+        VM_CASE(SET_LOCAL) {
+            reg[ip->b] = reg[ip->a];
+            bound[ip->b] = 1;
+            VM_NEXT();
+        }
+
+        VM_CASE(NEW_ARRAY) {
+            reg[ip->a] = DynamicObject(
+                std::make_shared<std::vector<DynamicObject>>(
+                    reg + ip->b, reg + ip->b + ip->c));
+            VM_NEXT();
+        }
+
+        VM_CASE(GET_INDEX) {
+            reg[ip->a] = ArrayAccessExpression::access(
+                VM_ADDRESS(), reg[ip->b], reg[ip->c]);
+            VM_NEXT();
+        }
+
+        VM_CASE(SET_INDEX) {
+            ArrayAssignmentExpression::assign(VM_ADDRESS(), reg[ip->a],
+                                              reg[ip->b], reg[ip->c]);
+            VM_NEXT();
+        }
+
+        VM_NUMERIC(ADD, +)
+        VM_NUMERIC(SUB, -)
+        VM_NUMERIC(MUL, *)
+        VM_BINARY(DIV, reg[ip->b] / reg[ip->c])
+        VM_BINARY(RDIV, reg[ip->c] / reg[ip->b])
+        VM_BINARY(MOD, reg[ip->b] % reg[ip->c])
+        VM_BINARY(BIT_AND, reg[ip->b] & reg[ip->c])
+        VM_BINARY(BIT_OR, reg[ip->b] | reg[ip->c])
+        VM_BINARY(BIT_XOR, reg[ip->b] ^ reg[ip->c])
+        VM_BINARY(SHIFT_LEFT, reg[ip->b] << reg[ip->c])
+        VM_BINARY(SHIFT_RIGHT, reg[ip->b] >> reg[ip->c])
+        VM_BINARY(LOGIC_AND, reg[ip->b] && reg[ip->c])
+        VM_BINARY(LOGIC_OR, reg[ip->b] || reg[ip->c])
+        VM_BINARY(EQUAL, DynamicObject(reg[ip->b] == reg[ip->c]))
+        VM_BINARY(NOT_EQUAL, DynamicObject(reg[ip->b] != reg[ip->c]))
+        VM_NUMERIC(LESS, <)
+        VM_NUMERIC(GREATER, >)
+        VM_NUMERIC(LESS_EQUAL, <=)
+        VM_NUMERIC(GREATER_EQUAL, >=)
+
+        VM_CASE(BINARY) {
+            reg[ip->a] = BinaryExpression::applyOperator(
+                VM_ADDRESS(), static_cast<BinaryOperator>(ip->c), reg[ip->a],
+                reg[ip->b]);
+            VM_NEXT();
+        }
+
+        VM_CASE(NOT) {
+            reg[ip->a] = DynamicObject(!reg[ip->b].booleanEquivalent());
+            VM_NEXT();
+        }
+
+        VM_CASE(NEGATE) {
+            if(reg[ip->b].isNumber())
+                reg[ip->a] = DynamicObject(-reg[ip->b].getNumber());
+            else
+                reg[ip->a] = UnaryExpression::applyOperator(
+                    VM_ADDRESS(), UnaryOperator::NEGATE, reg[ip->b]);
+            VM_NEXT();
+        }
+
+        VM_CASE(UNARY) {
+            reg[ip->a] = UnaryExpression::applyOperator(
+                VM_ADDRESS(), static_cast<UnaryOperator>(ip->c), reg[ip->b]);
+            VM_NEXT();
+        }
+
+        VM_CASE(JUMP) {
+            ip = code + ip->b;
+            VM_DISPATCH();
+        }
+
+        VM_CASE(JUMP_IF_FALSE) {
+            if(!reg[ip->a].booleanEquivalent())
+                ip = code + ip->b;
+            else
+                ++ip;
+            VM_DISPATCH();
+        }
+
+        VM_CASE(JUMP_IF_TRUE) {
+            if(reg[ip->a].booleanEquivalent())
+                ip = code + ip->b;
+            else
+                ++ip;
+            VM_DISPATCH();
+        }
+
+        VM_CASE(JUMP_IF_NOT_NIL) {
+            if(!reg[ip->a].isNil())
+                ip = code + ip->b;
+            else
+                ++ip;
+            VM_DISPATCH();
+        }
+
+        VM_CASE(TAIL_CALL) {
+            DynamicObject& func = reg[ip->b];
+            if(func.isFunction()) {
+                TailCall::schedule(
+                    func.getCallable(),
+                    std::vector<DynamicObject>(reg + ip->b + 1,
+                                               reg + ip->b + 1 + ip->c));
+
+                reg[ip->a] = DynamicObject();
+                VM_NEXT();
+            }
+        }
+        VM_FALLTHROUGH();
+
+        VM_CASE(CALL) {
+            DynamicObject& func = reg[ip->b];
+            if(!func.isFunction() && !func.isNative())
+                throw ASTNodeException(VM_ADDRESS(),
+                                       "Expression is not a function.");
+
+            std::vector<DynamicObject> args(reg + ip->b + 1,
+                                            reg + ip->b + 1 + ip->c);
+            if(func.isNative()) {
+                NativeBinding* binding = func.getNativeBinding();
+                binding->expect(VM_ADDRESS(), args.size());
+                auto nativeFunc = binding->resolve(VM_ADDRESS());
+                if(nativeFunc == nullptr)
+                    throw ASTNodeException(VM_ADDRESS(),
+                                           "Native function is nil.");
+
+                if(!locals)
+                    reg[ip->a] = (*nativeFunc)(VM_ADDRESS(), symbols, args,
+                                               Runtime::isUnsafeMode());
+                else {
+                    // Natives may look the caller's locals up by name, so
+                    // they get a frame holding them for the duration.
+                    CallFrame frame(locals, symbols.getReference());
+                    registers.store(*frame);
+
+                    DynamicObject value = (*nativeFunc)(
+                        VM_ADDRESS(), *frame, args, Runtime::isUnsafeMode());
+                    registers.load(*frame);
+                    reg[ip->a] = std::move(value);
+                }
+            } else
+                reg[ip->a] = func.getCallable()->call(symbols, args);
+
+            VM_COMPLETE();
+            VM_NEXT();
+        }
+
+        VM_CASE(RENDER) {
+            std::string str = reg[ip->a].toString();
+            bool errorStream = (ip->b & 2) != 0;
+
+            if(errorStream)
+                RheaUtil::renderError(str);
+            else
+                RheaUtil::render(str);
+
+            if((ip->b & 1) != 0) {
+                if(errorStream)
+                    RheaUtil::renderError("\r\n");
+                else
+                    RheaUtil::render("\r\n");
+            }
+
+            VM_NEXT();
+        }
+
+        VM_CASE(EVAL) {
+            reg[ip->a] = bytecode.getNode(ip->b)->visit(symbols);
+            VM_COMPLETE();
+            VM_NEXT();
+        }
+
+        VM_CASE(SIGNAL_BREAK) {
+            Completion::signal(CompletionType::BREAK, VM_ADDRESS());
+            VM_COMPLETE();
+        }
+
+        VM_CASE(SIGNAL_CONTINUE) {
+            Completion::signal(CompletionType::CONTINUE, VM_ADDRESS());
+            VM_COMPLETE();
+        }
+
+        VM_CASE(SIGNAL_RETURN) {
+            Completion::signal(CompletionType::RETURN, VM_ADDRESS());
+            VM_COMPLETE();
+        }
+
+        VM_CASE(RETURN) {
+            return reg[ip->a];
+        }
+
+#ifndef RHEA_VM_COMPUTED_GOTO
+        default:
+            throw std::runtime_error("Invalid bytecode instruction.");
+    }
+#endif
+
+#undef VM_NUMERIC
+#undef VM_BINARY
+#undef VM_COMPLETE
+#undef VM_POSITION
+#undef VM_ADDRESS
+#undef VM_NEXT
+#undef VM_FALLTHROUGH
+#undef VM_CASE
+#undef VM_DISPATCH
+}
+
+#ifdef RHEA_VM_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#endif
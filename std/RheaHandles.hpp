@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RHEA_STD_HANDLES_HPP
+#define RHEA_STD_HANDLES_HPP
+
+#include <memory>
+#include <rhea/ast/TerminativeSignal.hpp>
+#include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/HandleTable.hpp>
+#include <rhea/parser/Token.hpp>
+#include <string>
+
+// Resolves a handle argument to the object behind it, failing the call when
+// it is not an open handle of the expected kind.
+template <typename T>
+static T* findHandle(const std::shared_ptr<Token>& address,
+                     const DynamicObject& handle, const HandleKind& kind) {
+    void* object = HandleTable::find(handle, kind);
+    if(object == nullptr)
+        throw TerminativeThrowSignal(
+            address, "Invalid " + std::string(kind.name) + " handle");
+
+    return static_cast<T*>(object);
+}
+
+// Closes a handle and hands its object back to the caller, who now owns it.
+// Other copies of the handle stay valid values but no longer resolve.
+template <typename T>
+static T* takeHandle(const std::shared_ptr<Token>& address,
+                     const DynamicObject& handle, const HandleKind& kind) {
+    void* object = HandleTable::take(handle, kind);
+    if(object == nullptr)
+        throw TerminativeThrowSignal(
+            address, "Invalid " + std::string(kind.name) + " handle");
+
+    return static_cast<T*>(object);
+}
+
+// Closes a handle but leaves its object to the table. Calls still inside the
+// object keep it alive, and the last value holding the handle destroys it.
+template <typename T>
+static T* closeHandle(const std::shared_ptr<Token>& address,
+                      const DynamicObject& handle, const HandleKind& kind) {
+    void* object = HandleTable::close(handle, kind);
+    if(object == nullptr)
+        throw TerminativeThrowSignal(
+            address, "Invalid " + std::string(kind.name) + " handle");
+
+    return static_cast<T*>(object);
+}
+
+#endif
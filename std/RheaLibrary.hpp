@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <rhea/core/DynamicObject.hpp>
+#include <rhea/core/NativeModule.hpp>
 #include <rhea/core/Runtime.hpp>
 #include <rhea/core/SymbolTable.hpp>
 #include <rhea/parser/Token.hpp>
@@ -38,6 +39,25 @@
         throw TerminativeThrowSignal( \
             std::move(address), "Function requires unsafe mode turned on");
 
-#include <RheaStdlibMaps.hpp>
+// Registration table returned from `rhea_module_init`, one RHEA_EXPORT per
+// function between RHEA_MODULE_START and RHEA_MODULE_END.
+#define RHEA_MODULE_START                               \
+    extern "C" const NativeModule* rhea_module_init() { \
+        static const NativeEntry entries[] = {
+
+#define RHEA_EXPORT(name, funcName, arity, flags) \
+    {name, funcName, arity, flags},
+
+#define RHEA_MODULE_END                                              \
+    };                                                               \
+    static const NativeModule module = {                             \
+        RHEA_MODULE_VERSION,                                         \
+        static_cast<uint32_t>(sizeof(entries) / sizeof(entries[0])), \
+        entries};                                                    \
+                                                                     \
+    return &module;                                                  \
+    }
+
+#include <RheaHandles.hpp>
 
 #endif
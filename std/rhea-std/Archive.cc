@@ -17,11 +17,15 @@
  */
 
 #include <Rhea.hpp>
-#include <mutex>
 #include <rhea-std/Archive.hpp>
 #include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
+#include <zip.h>
 
-static std::mutex zipMtx;
+// An archive dropped without zip.close is discarded, like a file that was
+// never saved.
+static const HandleKind zipKind{"zip", [](void* object) {
+                                    zip_discard(static_cast<zip_t*>(object));
+                                }};
 
 RHEA_FUNC(archive_zip_open) {
     if(args.size() != 2)
@@ -41,21 +45,15 @@ RHEA_FUNC(archive_zip_open) {
     zip_t* zip = zip_open(path.toString().c_str(),
                           static_cast<int>(flags.getNumber()), &error);
 
-    std::string key = RheaUtil::uniqueKey();
     if(zip == NULL || error != 0) {
-        values.emplace_back(DynamicObject(key));
+        values.emplace_back(DynamicObject());
         values.emplace_back(DynamicObject(static_cast<double>(error)));
 
         return DynamicObject(
             std::make_shared<std::vector<DynamicObject>>(values));
     }
 
-    {
-        std::lock_guard<std::mutex> lock(zipMtx);
-        zipMap[key] = zip;
-    }
-
-    values.emplace_back(DynamicObject(key));
+    values.emplace_back(HandleTable::create(zipKind, zip));
     values.emplace_back(DynamicObject(static_cast<double>(error)));
 
     return DynamicObject(std::make_shared<std::vector<DynamicObject>>(values));
@@ -67,21 +65,10 @@ RHEA_FUNC(archive_zip_close) {
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    std::lock_guard<std::mutex> lock(zipMtx);
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
-
+    zip_t* zip = takeHandle<zip_t>(address, args.at(0), zipKind);
     int result = zip_close(zip);
-    zipMap.erase(it);
+
+    if(result != 0) zip_discard(zip);
     return DynamicObject(static_cast<double>(result));
 }
 
@@ -117,15 +104,10 @@ RHEA_FUNC(archive_zip_setPassword) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), password = args.at(1);
-    std::string keyStr = key.toString();
-    std::lock_guard<std::mutex> lock(zipMtx);
 
-    if(zipMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    return DynamicObject(zip_set_default_password(
-                             zipMap[keyStr], password.toString().c_str()) == 0);
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
+    return DynamicObject(
+        zip_set_default_password(zip, password.toString().c_str()) == 0);
 }
 
 RHEA_FUNC(archive_zip_setEncryption) {
@@ -136,7 +118,6 @@ RHEA_FUNC(archive_zip_setEncryption) {
 
     DynamicObject key = args.at(0), index = args.at(1), method = args.at(2),
                   password = args.at(3);
-    std::string keyStr = key.toString();
 
     if(!index.isNumber())
         throw TerminativeThrowSignal(
@@ -150,14 +131,9 @@ RHEA_FUNC(archive_zip_setEncryption) {
             "Method parameter should be of number type, got " +
                 method.objectType());
 
-    std::lock_guard<std::mutex> lock(zipMtx);
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
     return DynamicObject(
-        zip_file_set_encryption(zipMap[keyStr],
+        zip_file_set_encryption(zip,
                                 static_cast<uint16_t>(index.getNumber()),
                                 static_cast<uint16_t>(method.getNumber()),
                                 password.toString().c_str()) == 0);
@@ -172,7 +148,6 @@ RHEA_FUNC(archive_zip_addFromData) {
     DynamicObject key = args.at(0), flags = args.at(1),
                   compression = args.at(2), fileName = args.at(3),
                   buffer = args.at(4);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -186,15 +161,7 @@ RHEA_FUNC(archive_zip_addFromData) {
             "Compression parameter should be of number type, got " +
                 compression.objectType());
 
-    std::lock_guard<std::mutex> lock(zipMtx);
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::shared_ptr<std::vector<DynamicObject>> buf = buffer.getArray();
     size_t dataSize = buf->size();
@@ -261,7 +228,6 @@ RHEA_FUNC(archive_zip_addFromFile) {
     DynamicObject key = args.at(0), flags = args.at(1),
                   compression = args.at(2), fileName = args.at(3),
                   originFile = args.at(4);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -275,14 +241,7 @@ RHEA_FUNC(archive_zip_addFromFile) {
             "Compression parameter should be of number type, got " +
                 compression.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     zip_source_t* src =
         zip_source_file(zip, originFile.toString().c_str(), 0, 0);
@@ -328,7 +287,6 @@ RHEA_FUNC(archive_zip_addFromString) {
     DynamicObject key = args.at(0), flags = args.at(1),
                   compression = args.at(2), fileName = args.at(3),
                   buffer = args.at(4);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -342,14 +300,7 @@ RHEA_FUNC(archive_zip_addFromString) {
             "Compression parameter should be of number type, got " +
                 compression.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::string buf = buffer.toString();
     size_t dataSize = buf.size();
@@ -403,16 +354,8 @@ RHEA_FUNC(archive_zip_deleteFile) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), fileName = args.at(1);
-    std::string keyStr = key.toString();
-
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
 
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     int64_t index = zip_name_locate(zip, fileName.toString().c_str(), 0);
 
@@ -427,16 +370,8 @@ RHEA_FUNC(archive_zip_deleteDir) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), dirName = args.at(1);
-    std::string keyStr = key.toString();
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     int64_t num_entries = zip_get_num_entries(zip, 0);
     for(int64_t i = num_entries - 1; i >= 0; i--) {
@@ -458,7 +393,6 @@ RHEA_FUNC(archive_zip_getIndex) {
             "Expecting 3 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), fileName = args.at(1), flags = args.at(2);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -466,14 +400,7 @@ RHEA_FUNC(archive_zip_getIndex) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(static_cast<float>(
         zip_name_locate(zip, fileName.toString().c_str(),
@@ -487,7 +414,6 @@ RHEA_FUNC(archive_zip_hasFile) {
             "Expecting 3 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), fileName = args.at(1), flags = args.at(2);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -495,15 +421,7 @@ RHEA_FUNC(archive_zip_hasFile) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    std::lock_guard<std::mutex> lock(zipMtx);
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(zip_name_locate(zip, fileName.toString().c_str(),
                                          static_cast<int>(flags.getNumber())) >=
@@ -518,7 +436,6 @@ RHEA_FUNC(archive_zip_renameFile) {
 
     DynamicObject key = args.at(0), index = args.at(1), newName = args.at(2),
                   flags = args.at(3);
-    std::string keyStr = key.toString();
 
     if(!index.isNumber())
         throw TerminativeThrowSignal(
@@ -532,14 +449,7 @@ RHEA_FUNC(archive_zip_renameFile) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(
         zip_file_rename(zip, static_cast<uint64_t>(index.getNumber()),
@@ -554,7 +464,6 @@ RHEA_FUNC(archive_zip_entryCount) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), flags = args.at(1);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -562,14 +471,7 @@ RHEA_FUNC(archive_zip_entryCount) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(static_cast<float>(
         zip_get_num_entries(zip, static_cast<int>(flags.getNumber()))));
@@ -582,7 +484,6 @@ RHEA_FUNC(archive_zip_listEntries) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), flags = args.at(1);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -590,14 +491,7 @@ RHEA_FUNC(archive_zip_listEntries) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::shared_ptr<std::vector<DynamicObject>> entries =
         std::make_shared<std::vector<DynamicObject>>();
@@ -622,16 +516,8 @@ RHEA_FUNC(archive_zip_setComment) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), comment = args.at(1);
-    std::string keyStr = key.toString();
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::string commentStr = comment.toString();
     return DynamicObject(zip_set_archive_comment(zip, commentStr.c_str(),
@@ -645,7 +531,6 @@ RHEA_FUNC(archive_zip_getComment) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), flags = args.at(1);
-    std::string keyStr = key.toString();
 
     if(!flags.isNumber())
         throw TerminativeThrowSignal(
@@ -653,14 +538,7 @@ RHEA_FUNC(archive_zip_getComment) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     int lenp = 0;
     return DynamicObject(std::string(zip_get_archive_comment(
@@ -674,7 +552,6 @@ RHEA_FUNC(archive_zip_getFileComment) {
             "Expecting 3 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), index = args.at(1), flags = args.at(2);
-    std::string keyStr = key.toString();
 
     if(!index.isNumber())
         throw TerminativeThrowSignal(
@@ -688,14 +565,7 @@ RHEA_FUNC(archive_zip_getFileComment) {
             "Flags parameter should be of number type, got " +
                 flags.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     int lenp = 0;
     return DynamicObject(std::string(
@@ -710,7 +580,6 @@ RHEA_FUNC(archive_zip_setFileComment) {
             "Expecting 3 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), index = args.at(1), comment = args.at(2);
-    std::string keyStr = key.toString();
 
     if(!index.isNumber())
         throw TerminativeThrowSignal(
@@ -718,14 +587,7 @@ RHEA_FUNC(archive_zip_setFileComment) {
             "Index parameter should be of number type, got " +
                 index.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::string commentStr = comment.toString();
     return DynamicObject(
@@ -741,7 +603,6 @@ RHEA_FUNC(archive_zip_fileDosTime) {
 
     DynamicObject key = args.at(0), index = args.at(1), dosTime = args.at(2),
                   dosDate = args.at(3), flags = args.at(4);
-    std::string keyStr = key.toString();
 
     if(!index.isNumber())
         throw TerminativeThrowSignal(
@@ -767,14 +628,7 @@ RHEA_FUNC(archive_zip_fileDosTime) {
             "Index parameter should be of number type, got " +
                 index.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(
         zip_file_set_dostime(zip, static_cast<uint64_t>(index.getNumber()),
@@ -790,16 +644,8 @@ RHEA_FUNC(archive_zip_discard) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
 
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     zip_discard(zip);
     return DynamicObject();
@@ -813,7 +659,6 @@ RHEA_FUNC(archive_zip_registerProgressCallback) {
 
     DynamicObject key = args.at(0), precision = args.at(1),
                   callback = args.at(2);
-    std::string keyStr = key.toString();
 
     if(!precision.isNumber())
         throw TerminativeThrowSignal(
@@ -827,14 +672,7 @@ RHEA_FUNC(archive_zip_registerProgressCallback) {
             "Callback parameter should be of function type, got " +
                 callback.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     static SymbolTable& symbols = symtab;
     DynamicObject* cbPtr = new DynamicObject(callback);
@@ -865,7 +703,6 @@ RHEA_FUNC(archive_zip_registerCancelCallback) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(
@@ -873,14 +710,7 @@ RHEA_FUNC(archive_zip_registerCancelCallback) {
             "Callback parameter should be of function type, got " +
                 callback.objectType());
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     static SymbolTable& symbols = symtab;
     DynamicObject* cbPtr = new DynamicObject(callback);
@@ -909,17 +739,8 @@ RHEA_FUNC(archive_zip_readAsData) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), fileName = args.at(1);
-    std::string keyStr = key.toString();
 
-    std::lock_guard<std::mutex> lock(zipMtx);
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::shared_ptr<std::vector<DynamicObject>> buf =
         std::make_shared<std::vector<DynamicObject>>();
@@ -978,16 +799,8 @@ RHEA_FUNC(archive_zip_readAsString) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), fileName = args.at(1);
-    std::string keyStr = key.toString();
-
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
 
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::string actualFileNameStr = fileName.toString();
     const char* actualFileName = actualFileNameStr.c_str();
@@ -1041,20 +854,8 @@ RHEA_FUNC(archive_zip_fetchInfo) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), fileName = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(zipMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
 
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     std::string actualFileNameStr = fileName.toString();
     const char* actualFileName = actualFileNameStr.c_str();
@@ -1087,25 +888,13 @@ RHEA_FUNC(archive_zip_unchange) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), index = args.at(1);
-    std::string keyStr = key.toString();
 
     if(!index.isNumber())
         throw TerminativeThrowSignal(
             std::move(address),
             "Index argument must be of number type, got " + index.objectType());
 
-    if(zipMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(
         zip_unchange(zip, static_cast<uint64_t>(index.getNumber())) == 0);
@@ -1118,16 +907,8 @@ RHEA_FUNC(archive_zip_unchangeAll) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
 
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
-
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(zip_unchange_all(zip) == 0);
 }
@@ -1139,16 +920,8 @@ RHEA_FUNC(archive_zip_unchangeArchive) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    auto it = zipMap.find(keyStr);
-    if(it == zipMap.end())
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Zip key does not exist");
 
-    zip_t* zip = it->second;
-    if(zip == NULL)
-        throw TerminativeThrowSignal(std::move(address), "Invalid zip handle");
+    zip_t* zip = findHandle<zip_t>(address, key, zipKind);
 
     return DynamicObject(zip_unchange_archive(zip) == 0);
 }
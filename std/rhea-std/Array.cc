@@ -39,7 +39,7 @@ RHEA_FUNC(array_clear) {
         throw TerminativeThrowSignal(std::move(address),
                                      "Expecting more than or equal 1 argument");
 
-    parsync(size_t i = 0; i < args.size(); i++) {
+    for(size_t i = 0; i < args.size(); i++) {
         DynamicObject item = args.at(i);
 
         if(item.isArray())
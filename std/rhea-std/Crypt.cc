@@ -77,8 +77,8 @@ std::string calculateHash(const std::string& input, CryptAlgorithm algo) {
     std::stringstream ss;
     ss << std::hex << std::setfill('0');
 
-    parsync(unsigned int i = 0; i < hashLen; ++i) ss
-        << std::setw(2) << static_cast<int>(hash[i]);
+    for(unsigned int i = 0; i < hashLen; ++i)
+        ss << std::setw(2) << static_cast<int>(hash[i]);
 
     return ss.str();
 }
@@ -24,9 +24,17 @@
 
 #include <rhea/ast/TerminativeSignal.hpp>
 #include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
-#include <rhea/util/RandomUtil.hpp>
 #include <unordered_map>
 
+// GLFW owns monitors, and windows and cursors have to be destroyed on the
+// main thread before glfwTerminate, so none of them are released behind
+// the script's back; gl.destroyWindow and gl.destroyCursor still do that.
+static const HandleKind windowKind{"window", nullptr};
+static const HandleKind monitorKind{"monitor", nullptr};
+static const HandleKind cursorKind{"cursor", nullptr};
+
+static std::unordered_map<GLFWwindow*, DynamicObject> userPointers;
+
 RHEA_FUNC(gl_init) {
     return DynamicObject(glfwInit() == 1);
 }
@@ -126,12 +134,8 @@ RHEA_FUNC(gl_createWindow) {
     GLFWwindow* window = glfwCreateWindow(static_cast<int>(width.getNumber()),
                                           static_cast<int>(height.getNumber()),
                                           title.toString().c_str(), NULL, NULL);
-    std::string key = RheaUtil::uniqueKey();
-
     if(!window) return {};
-
-    windowMap[key] = window;
-    return DynamicObject(key);
+    return HandleTable::create(windowKind, window);
 }
 
 RHEA_FUNC(gl_makeContextCurrent) {
@@ -141,13 +145,10 @@ RHEA_FUNC(gl_makeContextCurrent) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    glfwMakeContextCurrent(windowMap[keyStr]);
-    return DynamicObject(keyStr);
+    glfwMakeContextCurrent(windowPtr);
+    return key;
 }
 
 RHEA_FUNC(gl_shouldCloseWindow) {
@@ -157,14 +158,10 @@ RHEA_FUNC(gl_shouldCloseWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     return DynamicObject(
-        static_cast<bool>(glfwWindowShouldClose(windowMap[keyStr])));
+        static_cast<bool>(glfwWindowShouldClose(windowPtr)));
 }
 
 RHEA_FUNC(gl_clear) {
@@ -232,13 +229,10 @@ RHEA_FUNC(gl_swapBuffers) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    glfwSwapBuffers(windowMap[keyStr]);
-    return DynamicObject(keyStr);
+    glfwSwapBuffers(windowPtr);
+    return key;
 }
 
 RHEA_FUNC(gl_pollEvents) {
@@ -258,13 +252,11 @@ RHEA_FUNC(gl_destroyWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = takeHandle<GLFWwindow>(address, key, windowKind);
 
-    glfwDestroyWindow(windowMap[keyStr]);
-    return DynamicObject(keyStr);
+    glfwDestroyWindow(windowPtr);
+    userPointers.erase(windowPtr);
+    return key;
 }
 
 RHEA_FUNC(gl_getMonitors) {
@@ -273,21 +265,14 @@ RHEA_FUNC(gl_getMonitors) {
 
     std::vector<DynamicObject> results;
     for(size_t i = 0; i < (size_t)count; i++) {
-        std::string key = RheaUtil::uniqueKey();
-
-        monitorMap[key] = monitors[i];
-        results.emplace_back(DynamicObject(key));
+        results.emplace_back(HandleTable::create(monitorKind, monitors[i]));
     }
 
     return DynamicObject(std::make_shared<std::vector<DynamicObject>>(results));
 }
 
 RHEA_FUNC(gl_primaryMonitor) {
-    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
-    std::string key = RheaUtil::uniqueKey();
-
-    monitorMap[key] = monitor;
-    return DynamicObject(key);
+    return HandleTable::create(monitorKind, glfwGetPrimaryMonitor());
 }
 
 RHEA_FUNC(gl_monitorPosition) {
@@ -297,13 +282,8 @@ RHEA_FUNC(gl_monitorPosition) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
-
-    GLFWmonitor* monitor = monitorMap[keyStr];
     int x = 0, y = 0;
     glfwGetMonitorPos(monitor, &x, &y);
 
@@ -321,13 +301,8 @@ RHEA_FUNC(gl_monitorWorkarea) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
-    GLFWmonitor* monitor = monitorMap[keyStr];
     int x = 0, y = 0, width = 0, height = 0;
     glfwGetMonitorWorkarea(monitor, &x, &y, &width, &height);
 
@@ -347,13 +322,8 @@ RHEA_FUNC(gl_monitorPhysicalSize) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
-
-    GLFWmonitor* monitor = monitorMap[keyStr];
     int width = 0, height = 0;
     glfwGetMonitorPhysicalSize(monitor, &width, &height);
 
@@ -371,13 +341,8 @@ RHEA_FUNC(gl_monitorContentScale) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
-    GLFWmonitor* monitor = monitorMap[keyStr];
     float width = 0, height = 0;
     glfwGetMonitorContentScale(monitor, &width, &height);
 
@@ -395,13 +360,8 @@ RHEA_FUNC(gl_monitorName) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
-
-    GLFWmonitor* monitor = monitorMap[keyStr];
     return DynamicObject(std::string(glfwGetMonitorName(monitor)));
 }
 
@@ -423,11 +383,8 @@ RHEA_FUNC(gl_setMonitorCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetMonitorCallback([](GLFWmonitor* monitor, int event) {
-        std::string monitorKey = RheaUtil::uniqueKey();
-        monitorMap[monitorKey] = monitor;
-
         std::vector<DynamicObject> params;
-        params.emplace_back(DynamicObject(monitorKey));
+        params.emplace_back(HandleTable::create(monitorKind, monitor));
         params.emplace_back(DynamicObject(static_cast<double>(event)));
 
         cbFunction->call(symbols, params);
@@ -443,14 +400,9 @@ RHEA_FUNC(gl_getVideoModes) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
     int count = 0;
-    GLFWmonitor* monitor = monitorMap[keyStr];
     const GLFWvidmode* modes = glfwGetVideoModes(monitor, &count);
 
     std::vector<DynamicObject> results;
@@ -480,13 +432,8 @@ RHEA_FUNC(gl_getVideoMode) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(monitorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Monitor key does not exist");
+    GLFWmonitor* monitor = findHandle<GLFWmonitor>(address, key, monitorKind);
 
-    GLFWmonitor* monitor = monitorMap[keyStr];
     const GLFWvidmode* mode = glfwGetVideoMode(monitor);
 
     std::vector<DynamicObject> results;
@@ -507,13 +454,9 @@ RHEA_FUNC(gl_setWindowTitle) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), title = args.at(1);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    glfwSetWindowTitle(windowMap[keyStr], title.toString().c_str());
+    glfwSetWindowTitle(windowPtr, title.toString().c_str());
     return {};
 }
 
@@ -524,14 +467,10 @@ RHEA_FUNC(gl_getWindowPos) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     int x = 0, y = 0;
-    glfwGetWindowPos(windowMap[keyStr], &x, &y);
+    glfwGetWindowPos(windowPtr, &x, &y);
 
     std::vector<DynamicObject> results;
     results.emplace_back(DynamicObject(static_cast<double>(x)));
@@ -547,17 +486,13 @@ RHEA_FUNC(gl_setWindowPos) {
             "Expecting 3 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), x = args.at(1), y = args.at(2);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!x.isNumber() || !y.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Position coordinates must be numbers");
 
-    glfwSetWindowPos(windowMap[keyStr], static_cast<int>(x.getNumber()),
+    glfwSetWindowPos(windowPtr, static_cast<int>(x.getNumber()),
                      static_cast<int>(y.getNumber()));
     return {};
 }
@@ -569,14 +504,10 @@ RHEA_FUNC(gl_getWindowSize) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     int width = 0, height = 0;
-    glfwGetWindowSize(windowMap[keyStr], &width, &height);
+    glfwGetWindowSize(windowPtr, &width, &height);
 
     std::vector<DynamicObject> results;
     results.emplace_back(DynamicObject(static_cast<double>(width)));
@@ -592,17 +523,13 @@ RHEA_FUNC(gl_setWindowSize) {
             "Expecting 3 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), width = args.at(1), height = args.at(2);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!width.isNumber() || !height.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Window dimensions must be numbers");
 
-    glfwSetWindowSize(windowMap[keyStr], static_cast<int>(width.getNumber()),
+    glfwSetWindowSize(windowPtr, static_cast<int>(width.getNumber()),
                       static_cast<int>(height.getNumber()));
     return {};
 }
@@ -614,17 +541,13 @@ RHEA_FUNC(gl_setWindowAspectRatio) {
             "Expecting 3 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), numer = args.at(1), denom = args.at(2);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!numer.isNumber() || !denom.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Aspect ratio values must be numbers");
 
-    glfwSetWindowAspectRatio(windowMap[keyStr],
+    glfwSetWindowAspectRatio(windowPtr,
                              static_cast<int>(numer.getNumber()),
                              static_cast<int>(denom.getNumber()));
     return {};
@@ -637,14 +560,10 @@ RHEA_FUNC(gl_getWindowFrameSize) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     int left = 0, top = 0, right = 0, bottom = 0;
-    glfwGetWindowFrameSize(windowMap[keyStr], &left, &top, &right, &bottom);
+    glfwGetWindowFrameSize(windowPtr, &left, &top, &right, &bottom);
 
     std::vector<DynamicObject> results;
     results.emplace_back(DynamicObject(static_cast<double>(left)));
@@ -662,13 +581,9 @@ RHEA_FUNC(gl_iconifyWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    glfwIconifyWindow(windowMap[keyStr]);
+    glfwIconifyWindow(windowPtr);
     return {};
 }
 
@@ -679,13 +594,9 @@ RHEA_FUNC(gl_restoreWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    glfwRestoreWindow(windowMap[keyStr]);
+    glfwRestoreWindow(windowPtr);
     return {};
 }
 
@@ -696,13 +607,9 @@ RHEA_FUNC(gl_maximizeWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    glfwMaximizeWindow(windowMap[keyStr]);
+    glfwMaximizeWindow(windowPtr);
     return {};
 }
 
@@ -713,13 +620,9 @@ RHEA_FUNC(gl_showWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    glfwShowWindow(windowMap[keyStr]);
+    glfwShowWindow(windowPtr);
     return {};
 }
 
@@ -730,13 +633,9 @@ RHEA_FUNC(gl_hideWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    glfwHideWindow(windowMap[keyStr]);
+    glfwHideWindow(windowPtr);
     return {};
 }
 
@@ -747,13 +646,9 @@ RHEA_FUNC(gl_focusWindow) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    glfwFocusWindow(windowMap[keyStr]);
+    glfwFocusWindow(windowPtr);
     return {};
 }
 
@@ -764,16 +659,12 @@ RHEA_FUNC(gl_getWindowMonitor) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWmonitor* monitor = glfwGetWindowMonitor(windowPtr);
+    if(monitor == nullptr) return {};
 
-    GLFWmonitor* monitor = glfwGetWindowMonitor(windowMap[keyStr]);
-    std::string monitorKey = RheaUtil::uniqueKey();
-    monitorMap[monitorKey] = monitor;
-    return DynamicObject(monitorKey);
+    return HandleTable::create(monitorKind, monitor);
 }
 
 RHEA_FUNC(gl_setWindowMonitor) {
@@ -784,14 +675,9 @@ RHEA_FUNC(gl_setWindowMonitor) {
 
     DynamicObject key = args.at(0), monitorKey = args.at(1), xpos = args.at(2),
                   ypos = args.at(3), width = args.at(4), height = args.at(5);
-    std::string keyStr = key.toString(), monitorStr = monitorKey.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    GLFWmonitor* monitor = nullptr;
-    if(monitorMap.count(monitorStr) == 1) monitor = monitorMap[monitorStr];
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
+    GLFWmonitor* monitor = static_cast<GLFWmonitor*>(
+        HandleTable::find(monitorKey, monitorKind));
 
     if(!xpos.isNumber() || !ypos.isNumber() || !width.isNumber() ||
        !height.isNumber())
@@ -799,7 +685,7 @@ RHEA_FUNC(gl_setWindowMonitor) {
                                      "Position and size must be numbers");
 
     glfwSetWindowMonitor(
-        windowMap[keyStr], monitor, static_cast<int>(xpos.getNumber()),
+        windowPtr, monitor, static_cast<int>(xpos.getNumber()),
         static_cast<int>(ypos.getNumber()), static_cast<int>(width.getNumber()),
         static_cast<int>(height.getNumber()), GLFW_DONT_CARE);
     return {};
@@ -812,15 +698,10 @@ RHEA_FUNC(gl_setWindowUserPointer) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), ptr = args.at(1);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    static std::unordered_map<std::string, DynamicObject> userPointerMap;
-    userPointerMap[keyStr] = ptr;
-    glfwSetWindowUserPointer(windowMap[keyStr], &userPointerMap[keyStr]);
+    userPointers[windowPtr] = ptr;
+    glfwSetWindowUserPointer(windowPtr, &userPointers[windowPtr]);
     return {};
 }
 
@@ -831,16 +712,12 @@ RHEA_FUNC(gl_getWindowUserPointer) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    void* ptr = glfwGetWindowUserPointer(windowPtr);
+    if(ptr == nullptr) return {};
 
-    static std::unordered_map<std::string, DynamicObject> userPointerMap;
-    void* ptr = glfwGetWindowUserPointer(windowMap[keyStr]);
-    if(ptr && userPointerMap.count(keyStr) == 1) return userPointerMap[keyStr];
-    return {};
+    return *static_cast<DynamicObject*>(ptr);
 }
 
 RHEA_FUNC(gl_setWindowPosCallback) {
@@ -850,11 +727,7 @@ RHEA_FUNC(gl_setWindowPosCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -864,7 +737,7 @@ RHEA_FUNC(gl_setWindowPosCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetWindowPosCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int xpos, int ypos) {
+        windowPtr, [](GLFWwindow* window, int xpos, int ypos) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(xpos)));
             params.emplace_back(DynamicObject(static_cast<double>(ypos)));
@@ -881,11 +754,7 @@ RHEA_FUNC(gl_setWindowSizeCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -895,7 +764,7 @@ RHEA_FUNC(gl_setWindowSizeCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetWindowSizeCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int width, int height) {
+        windowPtr, [](GLFWwindow* window, int width, int height) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(width)));
             params.emplace_back(DynamicObject(static_cast<double>(height)));
@@ -912,11 +781,7 @@ RHEA_FUNC(gl_setWindowCloseCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -925,7 +790,7 @@ RHEA_FUNC(gl_setWindowCloseCallback) {
     static auto cbFunction = callback.getCallable().get();
     static SymbolTable& symbols = symtab;
 
-    glfwSetWindowCloseCallback(windowMap[keyStr], [](GLFWwindow* window) {
+    glfwSetWindowCloseCallback(windowPtr, [](GLFWwindow* window) {
         std::vector<DynamicObject> params;
         cbFunction->call(symbols, params);
     });
@@ -940,11 +805,7 @@ RHEA_FUNC(gl_setWindowRefreshCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -953,7 +814,7 @@ RHEA_FUNC(gl_setWindowRefreshCallback) {
     static auto cbFunction = callback.getCallable().get();
     static SymbolTable& symbols = symtab;
 
-    glfwSetWindowRefreshCallback(windowMap[keyStr], [](GLFWwindow* window) {
+    glfwSetWindowRefreshCallback(windowPtr, [](GLFWwindow* window) {
         std::vector<DynamicObject> params;
         cbFunction->call(symbols, params);
     });
@@ -968,11 +829,7 @@ RHEA_FUNC(gl_setWindowFocusCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -982,7 +839,7 @@ RHEA_FUNC(gl_setWindowFocusCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetWindowFocusCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int focused) {
+        windowPtr, [](GLFWwindow* window, int focused) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<bool>(focused)));
             cbFunction->call(symbols, params);
@@ -998,11 +855,7 @@ RHEA_FUNC(gl_setWindowIconifyCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1012,7 +865,7 @@ RHEA_FUNC(gl_setWindowIconifyCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetWindowIconifyCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int iconified) {
+        windowPtr, [](GLFWwindow* window, int iconified) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<bool>(iconified)));
             cbFunction->call(symbols, params);
@@ -1028,11 +881,7 @@ RHEA_FUNC(gl_setWindowMaximizeCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1042,7 +891,7 @@ RHEA_FUNC(gl_setWindowMaximizeCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetWindowMaximizeCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int maximized) {
+        windowPtr, [](GLFWwindow* window, int maximized) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<bool>(maximized)));
             cbFunction->call(symbols, params);
@@ -1058,11 +907,7 @@ RHEA_FUNC(gl_setWindowContentScaleCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1072,7 +917,7 @@ RHEA_FUNC(gl_setWindowContentScaleCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetWindowContentScaleCallback(
-        windowMap[keyStr], [](GLFWwindow* window, float xscale, float yscale) {
+        windowPtr, [](GLFWwindow* window, float xscale, float yscale) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(xscale));
             params.emplace_back(DynamicObject(yscale));
@@ -1089,11 +934,7 @@ RHEA_FUNC(gl_setWindowAspectRatioCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1103,7 +944,7 @@ RHEA_FUNC(gl_setWindowAspectRatioCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetFramebufferSizeCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int width, int height) {
+        windowPtr, [](GLFWwindow* window, int width, int height) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(width)));
             params.emplace_back(DynamicObject(static_cast<double>(height)));
@@ -1120,11 +961,7 @@ RHEA_FUNC(gl_setKeyCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1134,7 +971,7 @@ RHEA_FUNC(gl_setKeyCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetKeyCallback(
-        windowMap[keyStr],
+        windowPtr,
         [](GLFWwindow* window, int key, int scancode, int action, int mods) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(key)));
@@ -1154,11 +991,7 @@ RHEA_FUNC(gl_setCharCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1168,7 +1001,7 @@ RHEA_FUNC(gl_setCharCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetCharCallback(
-        windowMap[keyStr], [](GLFWwindow* window, unsigned int codepoint) {
+        windowPtr, [](GLFWwindow* window, unsigned int codepoint) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(codepoint)));
             cbFunction->call(symbols, params);
@@ -1184,11 +1017,7 @@ RHEA_FUNC(gl_setCharModsCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1198,7 +1027,7 @@ RHEA_FUNC(gl_setCharModsCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetCharModsCallback(
-        windowMap[keyStr],
+        windowPtr,
         [](GLFWwindow* window, unsigned int codepoint, int mods) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(codepoint)));
@@ -1216,11 +1045,7 @@ RHEA_FUNC(gl_setMouseButtonCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1230,7 +1055,7 @@ RHEA_FUNC(gl_setMouseButtonCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetMouseButtonCallback(
-        windowMap[keyStr],
+        windowPtr,
         [](GLFWwindow* window, int button, int action, int mods) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<double>(button)));
@@ -1249,11 +1074,7 @@ RHEA_FUNC(gl_setCursorPosCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1262,7 +1083,7 @@ RHEA_FUNC(gl_setCursorPosCallback) {
     static auto cbFunction = callback.getCallable().get();
     static SymbolTable& symbols = symtab;
 
-    glfwSetCursorPosCallback(windowMap[keyStr],
+    glfwSetCursorPosCallback(windowPtr,
                              [](GLFWwindow* window, double xpos, double ypos) {
                                  std::vector<DynamicObject> params;
                                  params.emplace_back(DynamicObject(xpos));
@@ -1280,11 +1101,7 @@ RHEA_FUNC(gl_setCursorEnterCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1294,7 +1111,7 @@ RHEA_FUNC(gl_setCursorEnterCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetCursorEnterCallback(
-        windowMap[keyStr], [](GLFWwindow* window, int entered) {
+        windowPtr, [](GLFWwindow* window, int entered) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(static_cast<bool>(entered)));
             cbFunction->call(symbols, params);
@@ -1310,11 +1127,7 @@ RHEA_FUNC(gl_setScrollCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1324,7 +1137,7 @@ RHEA_FUNC(gl_setScrollCallback) {
     static SymbolTable& symbols = symtab;
 
     glfwSetScrollCallback(
-        windowMap[keyStr],
+        windowPtr,
         [](GLFWwindow* window, double xoffset, double yoffset) {
             std::vector<DynamicObject> params;
             params.emplace_back(DynamicObject(xoffset));
@@ -1342,11 +1155,7 @@ RHEA_FUNC(gl_setDropCallback) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), callback = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!callback.isFunction())
         throw TerminativeThrowSignal(std::move(address),
@@ -1355,7 +1164,7 @@ RHEA_FUNC(gl_setDropCallback) {
     static auto cbFunction = callback.getCallable().get();
     static SymbolTable& symbols = symtab;
 
-    glfwSetDropCallback(windowMap[keyStr], [](GLFWwindow* window, int count,
+    glfwSetDropCallback(windowPtr, [](GLFWwindow* window, int count,
                                               const char** paths) {
         std::vector<DynamicObject> pathList;
         for(int i = 0; i < count; i++)
@@ -1376,18 +1185,14 @@ RHEA_FUNC(gl_getKey) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), keyVal = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!keyVal.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Key must be a number");
 
     return DynamicObject(static_cast<bool>(
-        glfwGetKey(windowMap[keyStr], static_cast<int>(keyVal.getNumber()))));
+        glfwGetKey(windowPtr, static_cast<int>(keyVal.getNumber()))));
 }
 
 RHEA_FUNC(gl_getKeyName) {
@@ -1430,18 +1235,14 @@ RHEA_FUNC(gl_getMouseButton) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), button = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!button.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Button must be a number");
 
     return DynamicObject(static_cast<bool>(glfwGetMouseButton(
-        windowMap[keyStr], static_cast<int>(button.getNumber()))));
+        windowPtr, static_cast<int>(button.getNumber()))));
 }
 
 RHEA_FUNC(gl_getCursorPos) {
@@ -1451,14 +1252,10 @@ RHEA_FUNC(gl_getCursorPos) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     double xpos = 0, ypos = 0;
-    glfwGetCursorPos(windowMap[keyStr], &xpos, &ypos);
+    glfwGetCursorPos(windowPtr, &xpos, &ypos);
 
     std::vector<DynamicObject> results;
     results.emplace_back(DynamicObject(xpos));
@@ -1474,17 +1271,13 @@ RHEA_FUNC(gl_setCursorPos) {
             "Expecting 3 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), xpos = args.at(1), ypos = args.at(2);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!xpos.isNumber() || !ypos.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Position must be numbers");
 
-    glfwSetCursorPos(windowMap[keyStr], xpos.getNumber(), ypos.getNumber());
+    glfwSetCursorPos(windowPtr, xpos.getNumber(), ypos.getNumber());
     return {};
 }
 
@@ -1495,17 +1288,13 @@ RHEA_FUNC(gl_setCursorMode) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), mode = args.at(1);
-    std::string keyStr = key.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
 
     if(!mode.isNumber())
         throw TerminativeThrowSignal(std::move(address),
                                      "Mode must be a number");
 
-    glfwSetInputMode(windowMap[keyStr], GLFW_CURSOR,
+    glfwSetInputMode(windowPtr, GLFW_CURSOR,
                      static_cast<int>(mode.getNumber()));
     return {};
 }
@@ -1530,9 +1319,9 @@ RHEA_FUNC(gl_createCursor) {
     GLFWcursor* cursor =
         glfwCreateCursor(&img, static_cast<int>(xhot.getNumber()),
                          static_cast<int>(yhot.getNumber()));
-    std::string key = RheaUtil::uniqueKey();
-    cursorMap[key] = cursor;
-    return DynamicObject(key);
+    if(cursor == nullptr) return {};
+
+    return HandleTable::create(cursorKind, cursor);
 }
 
 RHEA_FUNC(gl_createStandardCursor) {
@@ -1549,9 +1338,9 @@ RHEA_FUNC(gl_createStandardCursor) {
 
     GLFWcursor* cursor =
         glfwCreateStandardCursor(static_cast<int>(shape.getNumber()));
-    std::string key = RheaUtil::uniqueKey();
-    cursorMap[key] = cursor;
-    return DynamicObject(key);
+    if(cursor == nullptr) return {};
+
+    return HandleTable::create(cursorKind, cursor);
 }
 
 RHEA_FUNC(gl_destroyCursor) {
@@ -1561,14 +1350,7 @@ RHEA_FUNC(gl_destroyCursor) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    if(cursorMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Cursor key does not exist");
-
-    glfwDestroyCursor(cursorMap[keyStr]);
-    cursorMap.erase(keyStr);
+    glfwDestroyCursor(takeHandle<GLFWcursor>(address, key, cursorKind));
     return {};
 }
 
@@ -1579,16 +1361,11 @@ RHEA_FUNC(gl_setCursor) {
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
     DynamicObject key = args.at(0), cursorKey = args.at(1);
-    std::string keyStr = key.toString(), cursorStr = cursorKey.toString();
-
-    if(windowMap.count(keyStr) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Window key does not exist");
-
-    GLFWcursor* cursor = nullptr;
-    if(cursorMap.count(cursorStr) == 1) cursor = cursorMap[cursorStr];
+    GLFWwindow* windowPtr = findHandle<GLFWwindow>(address, key, windowKind);
+    GLFWcursor* cursor =
+        static_cast<GLFWcursor*>(HandleTable::find(cursorKey, cursorKind));
 
-    glfwSetCursor(windowMap[keyStr], cursor);
+    glfwSetCursor(windowPtr, cursor);
     return {};
 }
 
@@ -53,7 +53,7 @@ RHEA_FUNC(io_print) {
 RHEA_FUNC(io_printLine) {
     if(args.size() == 0) return {};
 
-    parsync(size_t i = 0; i < args.size(); i++) {
+    for(size_t i = 0; i < args.size(); i++) {
         DynamicObject arg = args.at(i);
         std::lock_guard<std::mutex> lock(ioMtx);
         std::cout << arg.toString() << std::endl;
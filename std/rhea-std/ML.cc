@@ -20,6 +20,7 @@
 
 #include <Rhea.hpp>
 #include <chisei/idx_loader.hpp>
+#include <chisei/neural_network.hpp>
 #include <cmath>
 #include <exception>
 #include <rhea/ast/TerminativeSignal.hpp>
@@ -27,11 +28,16 @@
 #include <rhea/util/VectorMath.hpp>
 #include <vector>
 
+static const HandleKind networkKind{
+    "network", [](void* object) {
+        delete static_cast<chisei::NeuralNetwork*>(object);
+    }};
+
 static inline std::vector<double> arrayToDoubleVector(
     std::shared_ptr<Token> address, std::vector<DynamicObject> array) {
     std::vector<double> values(array.size());
 
-    parsync(size_t i = 0; i < array.size(); i++) {
+    for(size_t i = 0; i < array.size(); i++) {
         if(!array[i].isNumber())
             throw TerminativeThrowSignal(std::move(address),
                                          "Value from array is not a number");
@@ -48,7 +54,7 @@ static inline double calculateMean(std::shared_ptr<Token> address,
     size_t arraySize = array.size();
     double sum = 0.0;
 
-    parsync(size_t i = 0; i < arraySize; i++) sum += values[i];
+    for(size_t i = 0; i < arraySize; i++) sum += values[i];
 
     return sum / arraySize;
 }
@@ -76,7 +82,7 @@ RHEA_FUNC(ml_trendline_calculate) {
            y = calculateMean(std::move(address), yObjArray), numerator = 0.0,
            denominator = 0.0;
 
-    parsync(size_t i = 0; i < xObjArray.size(); i++) {
+    for(size_t i = 0; i < xObjArray.size(); i++) {
         numerator +=
             (xObjArray[i].getNumber() - x) * (yObjArray[i].getNumber() - y);
 
@@ -190,7 +196,6 @@ RHEA_FUNC(ml_ann_create) {
             std::move(address),
             "Activation function and derivative should be of function type.");
 
-    std::string id = RheaUtil::uniqueKey();
     std::vector<double> doubleLayers = RheaUtil::object2Vector(layers);
     std::vector<size_t> layerSizes;
 
@@ -198,7 +203,7 @@ RHEA_FUNC(ml_ann_create) {
     for(double d : doubleLayers) layerSizes.push_back(static_cast<size_t>(d));
 
     SymbolTable symbols = symtab;
-    neuralNetworkMap[id] = std::make_shared<chisei::NeuralNetwork>(
+    chisei::NeuralNetwork* network = new chisei::NeuralNetwork(
         layerSizes,
         [activation, symbols, unsafe](double arg) -> double {
             std::vector<DynamicObject> callArgs;
@@ -219,7 +224,7 @@ RHEA_FUNC(ml_ann_create) {
             return result.isNumber() ? result.getNumber() : 0.0;
         });
 
-    return DynamicObject(id);
+    return HandleTable::create(networkKind, network);
 }
 
 RHEA_FUNC(ml_ann_fromMnist) {
@@ -241,13 +246,11 @@ RHEA_FUNC(ml_ann_fromMnist) {
             std::move(address),
             "Learning rate and epoch should be of number type.");
 
-    std::string id = RheaUtil::uniqueKey();
-    neuralNetworkMap[id] =
-        std::make_shared<chisei::NeuralNetwork>(chisei::IDXLoader::fromMNIST(
+    return HandleTable::create(
+        networkKind,
+        new chisei::NeuralNetwork(chisei::IDXLoader::fromMNIST(
             imageFile.toString(), labelFile.toString(),
-            learningRate.getNumber(), epoch.getNumber()));
-
-    return DynamicObject(id);
+            learningRate.getNumber(), epoch.getNumber())));
 }
 
 RHEA_FUNC(ml_ann_fromModelFile) {
@@ -261,11 +264,10 @@ RHEA_FUNC(ml_ann_fromModelFile) {
         throw TerminativeThrowSignal(std::move(address),
                                      "Path parameter should be of string.");
 
-    std::string id = RheaUtil::uniqueKey();
-    neuralNetworkMap[id] = std::make_unique<chisei::NeuralNetwork>(
-        chisei::NeuralNetwork::loadFromModel(path.toString()));
-
-    return DynamicObject(id);
+    return HandleTable::create(
+        networkKind,
+        new chisei::NeuralNetwork(
+            chisei::NeuralNetwork::loadFromModel(path.toString())));
 }
 
 RHEA_FUNC(ml_ann_train) {
@@ -277,10 +279,8 @@ RHEA_FUNC(ml_ann_train) {
     DynamicObject ann = args.at(0), inputs = args.at(1), targets = args.at(2),
                   learningRate = args.at(3), epoch = args.at(4);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
     if(!inputs.getArray())
         throw TerminativeThrowSignal(
@@ -320,8 +320,8 @@ RHEA_FUNC(ml_ann_train) {
         targetVec.emplace_back(RheaUtil::object2Vector(tgtv));
     }
 
-    neuralNetworkMap[id]->train(inputVec, targetVec, learningRate.getNumber(),
-                                epoch.getNumber());
+    network->train(inputVec, targetVec, learningRate.getNumber(),
+                   epoch.getNumber());
     return {};
 }
 
@@ -333,10 +333,8 @@ RHEA_FUNC(ml_ann_predict) {
 
     DynamicObject ann = args.at(0), inputs = args.at(1);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
     if(!inputs.isArray() || !RheaUtil::isNumberArray(*inputs.getArray().get()))
         throw TerminativeThrowSignal(
@@ -344,7 +342,7 @@ RHEA_FUNC(ml_ann_predict) {
             "Inputs parameter should be of number array type.");
 
     return DynamicObject(RheaUtil::vector2Object(
-        neuralNetworkMap[id]->predict(RheaUtil::object2Vector(inputs))));
+        network->predict(RheaUtil::object2Vector(inputs))));
 }
 
 RHEA_FUNC(ml_ann_calculateMseLoss) {
@@ -356,10 +354,8 @@ RHEA_FUNC(ml_ann_calculateMseLoss) {
     DynamicObject ann = args.at(0), predictions = args.at(1),
                   targets = args.at(2);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
     if(!predictions.isArray() ||
        !RheaUtil::isNumberArray(*predictions.getArray().get()))
@@ -373,7 +369,7 @@ RHEA_FUNC(ml_ann_calculateMseLoss) {
             std::move(address),
             "Targets parameter should be of number array type.");
 
-    return DynamicObject(neuralNetworkMap[id]->compute_mse_loss(
+    return DynamicObject(network->compute_mse_loss(
         RheaUtil::object2Vector(predictions),
         RheaUtil::object2Vector(targets)));
 }
@@ -387,10 +383,8 @@ RHEA_FUNC(ml_ann_computeOutputGradient) {
     DynamicObject ann = args.at(0), predictions = args.at(1),
                   targets = args.at(2);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
     if(!predictions.isArray() ||
        !RheaUtil::isNumberArray(*predictions.getArray().get()))
@@ -404,10 +398,9 @@ RHEA_FUNC(ml_ann_computeOutputGradient) {
             std::move(address),
             "Targets parameter should be of number array type.");
 
-    return DynamicObject(
-        RheaUtil::vector2Object(neuralNetworkMap[id]->compute_output_gradient(
-            RheaUtil::object2Vector(predictions),
-            RheaUtil::object2Vector(targets))));
+    return DynamicObject(RheaUtil::vector2Object(
+        network->compute_output_gradient(RheaUtil::object2Vector(predictions),
+                                         RheaUtil::object2Vector(targets))));
 }
 
 RHEA_FUNC(ml_ann_computeAccuracy) {
@@ -418,10 +411,8 @@ RHEA_FUNC(ml_ann_computeAccuracy) {
 
     DynamicObject ann = args.at(0), inputs = args.at(1), targets = args.at(2);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
     if(!inputs.getArray())
         throw TerminativeThrowSignal(
@@ -452,8 +443,7 @@ RHEA_FUNC(ml_ann_computeAccuracy) {
         targetVec.emplace_back(RheaUtil::object2Vector(tgtv));
     }
 
-    return DynamicObject(
-        neuralNetworkMap[id]->compute_accuracy(inputVec, targetVec));
+    return DynamicObject(network->compute_accuracy(inputVec, targetVec));
 }
 
 RHEA_FUNC(ml_ann_isCorrectPrediction) {
@@ -465,10 +455,8 @@ RHEA_FUNC(ml_ann_isCorrectPrediction) {
     DynamicObject ann = args.at(0), predictions = args.at(1),
                   targets = args.at(2);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
     if(!predictions.isArray() ||
        !RheaUtil::isNumberArray(*predictions.getArray().get()))
@@ -482,7 +470,7 @@ RHEA_FUNC(ml_ann_isCorrectPrediction) {
             std::move(address),
             "Targets parameter should be of number array type.");
 
-    return DynamicObject(neuralNetworkMap[id]->is_correct_prediction(
+    return DynamicObject(network->is_correct_prediction(
         RheaUtil::object2Vector(predictions),
         RheaUtil::object2Vector(targets)));
 }
@@ -495,11 +483,9 @@ RHEA_FUNC(ml_ann_saveModel) {
 
     DynamicObject ann = args.at(0), path = args.at(1);
 
-    std::string id = ann.toString();
-    if(neuralNetworkMap.count(id) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Neural network map ID not found.");
+    chisei::NeuralNetwork* network =
+        findHandle<chisei::NeuralNetwork>(address, ann, networkKind);
 
-    neuralNetworkMap[id]->save_model(path.toString());
+    network->save_model(path.toString());
     return {};
 }
@@ -761,7 +761,7 @@ RHEA_FUNC(math_activation_softmax) {
     if(len == 0) return {};
 
     double max = values.at(0).getNumber(), sum = 0.0;
-    parsync(size_t i = 1; i < len; i++) {
+    for(size_t i = 1; i < len; i++) {
         double j = values.at(i).getNumber();
 
         if(j > max) max = j;
@@ -0,0 +1,573 @@
+/*
+ * Copyright (c) 2025 - Nathanne Isip
+ * This file is part of Rhea.
+ *
+ * Rhea is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published
+ * by the Free Software Foundation, either version 3 of the License,
+ * or (at your option) any later version.
+ *
+ * Rhea is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Rhea. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "rhea-std/Archive.hpp"
+#include "rhea-std/Array.hpp"
+#include "rhea-std/Chrono.hpp"
+#include "rhea-std/Conv.hpp"
+#include "rhea-std/Crypt.hpp"
+#include "rhea-std/Env.hpp"
+#include "rhea-std/GL.hpp"
+#include "rhea-std/IO.hpp"
+#include "rhea-std/Lang.hpp"
+#include "rhea-std/ML.hpp"
+#include "rhea-std/Math.hpp"
+#include "rhea-std/Net.hpp"
+#include "rhea-std/Reflect.hpp"
+#include "rhea-std/RegEx.hpp"
+#include "rhea-std/Str.hpp"
+#include "rhea-std/Sys.hpp"
+#include "rhea-std/Thread.hpp"
+#include "rhea-std/Unsafe.hpp"
+
+RHEA_MODULE_START
+
+    RHEA_EXPORT("archive.zip.open", archive_zip_open, 2, 0)
+    RHEA_EXPORT("archive.zip.close", archive_zip_close, 1, 0)
+    RHEA_EXPORT("archive.zip.compressionMethod",
+                archive_zip_compressionMethod, 2, 0)
+    RHEA_EXPORT("archive.zip.setPassword", archive_zip_setPassword, 2, 0)
+    RHEA_EXPORT("archive.zip.setEncryption", archive_zip_setEncryption, 4, 0)
+    RHEA_EXPORT("archive.zip.addFromFile", archive_zip_addFromFile, 5, 0)
+    RHEA_EXPORT("archive.zip.addFromData", archive_zip_addFromData, 5, 0)
+    RHEA_EXPORT("archive.zip.addFromString", archive_zip_addFromString, 5, 0)
+    RHEA_EXPORT("archive.zip.deleteFile", archive_zip_deleteFile, 2, 0)
+    RHEA_EXPORT("archive.zip.deleteDir", archive_zip_deleteDir, 2, 0)
+    RHEA_EXPORT("archive.zip.getIndex", archive_zip_getIndex, 3, 0)
+    RHEA_EXPORT("archive.zip.hasFile", archive_zip_hasFile, 3, 0)
+    RHEA_EXPORT("archive.zip.renameFile", archive_zip_renameFile, 4, 0)
+    RHEA_EXPORT("archive.zip.entryCount", archive_zip_entryCount, 2, 0)
+    RHEA_EXPORT("archive.zip.listEntries", archive_zip_listEntries, 2, 0)
+    RHEA_EXPORT("archive.zip.getComment", archive_zip_getComment, 2, 0)
+    RHEA_EXPORT("archive.zip.setComment", archive_zip_setComment, 2, 0)
+    RHEA_EXPORT("archive.zip.getFileComment", archive_zip_getFileComment, 3, 0)
+    RHEA_EXPORT("archive.zip.setFileComment", archive_zip_setFileComment, 3, 0)
+    RHEA_EXPORT("archive.zip.fileDosTime", archive_zip_fileDosTime, 5, 0)
+    RHEA_EXPORT("archive.zip.discard", archive_zip_discard, 1, 0)
+    RHEA_EXPORT("archive.zip.registerProgressCallback",
+                archive_zip_registerProgressCallback, 3, 0)
+    RHEA_EXPORT("archive.zip.registerCancelCallback",
+                archive_zip_registerCancelCallback, 2, 0)
+    RHEA_EXPORT("archive.zip.readAsData", archive_zip_readAsData, 2, 0)
+    RHEA_EXPORT("archive.zip.readAsString", archive_zip_readAsString, 2, 0)
+    RHEA_EXPORT("archive.zip.fetchInfo", archive_zip_fetchInfo, 2, 0)
+    RHEA_EXPORT("archive.zip.unchange", archive_zip_unchange, 2, 0)
+    RHEA_EXPORT("archive.zip.unchangeAll", archive_zip_unchangeAll, 1, 0)
+    RHEA_EXPORT("archive.zip.unchangeArchive", archive_zip_unchangeArchive, 1,
+                0)
+
+    RHEA_EXPORT("array.create", array_create, -1, 0)
+    RHEA_EXPORT("array.clear", array_clear, -1, 0)
+    RHEA_EXPORT("array.length", array_length, 1, 0)
+    RHEA_EXPORT("array.reverse", array_reverse, 1, 0)
+    RHEA_EXPORT("array.first", array_first, 1, 0)
+    RHEA_EXPORT("array.last", array_last, 1, 0)
+    RHEA_EXPORT("array.add", array_add, -1, 0)
+    RHEA_EXPORT("array.pushBack", array_pushBack, 2, 0)
+    RHEA_EXPORT("array.pushFront", array_pushFront, 2, 0)
+    RHEA_EXPORT("array.assign", array_assign, 3, 0)
+    RHEA_EXPORT("array.slice", array_slice, 3, 0)
+    RHEA_EXPORT("array.remove", array_remove, 2, 0)
+    RHEA_EXPORT("array.removeAt", array_removeAt, 2, 0)
+    RHEA_EXPORT("array.removeAll", array_removeAll, 2, 0)
+    RHEA_EXPORT("array.removeSlice", array_removeSlice, 3, 0)
+    RHEA_EXPORT("array.contains", array_contains, 2, 0)
+    RHEA_EXPORT("array.find", array_find, 2, 0)
+    RHEA_EXPORT("array.at", array_at, 2, 0)
+    RHEA_EXPORT("array.join", array_join, 2, 0)
+    RHEA_EXPORT("array.areAllString", array_areAllString, 1, 0)
+    RHEA_EXPORT("array.areAllNumber", array_areAllNumber, 1, 0)
+    RHEA_EXPORT("array.areAllFunction", array_areAllFunction, 1, 0)
+    RHEA_EXPORT("array.areAllBool", array_areAllBool, 1, 0)
+    RHEA_EXPORT("array.areAllRegex", array_areAllRegex, 1, 0)
+    RHEA_EXPORT("array.areAllArray", array_areAllArray, 1, 0)
+    RHEA_EXPORT("array.areAllNil", array_areAllNil, 1, 0)
+
+    RHEA_EXPORT("chrono.now", chrono_now, -1, 0)
+    RHEA_EXPORT("chrono.since", chrono_since, 1, 0)
+    RHEA_EXPORT("chrono.ms", chrono_ms, 1, 0)
+    RHEA_EXPORT("chrono.seconds", chrono_seconds, 1, 0)
+    RHEA_EXPORT("chrono.minutes", chrono_minutes, 1, 0)
+    RHEA_EXPORT("chrono.hour", chrono_hour, 1, 0)
+    RHEA_EXPORT("chrono.day", chrono_day, 1, 0)
+    RHEA_EXPORT("chrono.month", chrono_month, 1, 0)
+    RHEA_EXPORT("chrono.year", chrono_year, 1, 0)
+    RHEA_EXPORT("chrono.dayNum", chrono_dayNum, 1, 0)
+    RHEA_EXPORT("chrono.dayFromStart", chrono_dayFromStart, 1, 0)
+    RHEA_EXPORT("chrono.clock", chrono_clock, -1, 0)
+    RHEA_EXPORT("chrono.format", chrono_format, 2, 0)
+    RHEA_EXPORT("chrono.toGmt", chrono_toGmt, 1, 0)
+
+    RHEA_EXPORT("conv.toString", conv_toString, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("conv.toNumber", conv_toNumber, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("conv.toRegex", conv_toRegex, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("conv.toBool", conv_toBool, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+
+    RHEA_EXPORT("crypt.md4", crypt_md4, 1, 0)
+    RHEA_EXPORT("crypt.validateMd4", crypt_validateMd4, 1, 0)
+    RHEA_EXPORT("crypt.md5", crypt_md5, 1, 0)
+    RHEA_EXPORT("crypt.validateMd5", crypt_validateMd5, 1, 0)
+    RHEA_EXPORT("crypt.sha224", crypt_sha224, 1, 0)
+    RHEA_EXPORT("crypt.validateSha224", crypt_validateSha224, 1, 0)
+    RHEA_EXPORT("crypt.sha256", crypt_sha256, 1, 0)
+    RHEA_EXPORT("crypt.validateSha256", crypt_validateSha256, 1, 0)
+    RHEA_EXPORT("crypt.sha384", crypt_sha384, 1, 0)
+    RHEA_EXPORT("crypt.validateSha384", crypt_validateSha384, 1, 0)
+    RHEA_EXPORT("crypt.sha512", crypt_sha512, 1, 0)
+    RHEA_EXPORT("crypt.validateSha512", crypt_validateSha512, 1, 0)
+
+    RHEA_EXPORT("env.set", env_set, 2, 0)
+    RHEA_EXPORT("env.get", env_get, 1, 0)
+
+#ifndef __TERMUX__
+    RHEA_EXPORT("gl.init", gl_init, -1, 0)
+    RHEA_EXPORT("gl.initHint", gl_initHint, 2, 0)
+    RHEA_EXPORT("gl.versionString", gl_versionString, -1, 0)
+    RHEA_EXPORT("gl.getError", gl_getError, -1, 0)
+    RHEA_EXPORT("gl.setErrorCallback", gl_setErrorCallback, 1, 0)
+    RHEA_EXPORT("gl.terminate", gl_terminate, -1, 0)
+    RHEA_EXPORT("gl.createWindow", gl_createWindow, 3, 0)
+    RHEA_EXPORT("gl.makeContextCurrent", gl_makeContextCurrent, 1, 0)
+    RHEA_EXPORT("gl.shouldCloseWindow", gl_shouldCloseWindow, 1, 0)
+    RHEA_EXPORT("gl.clear", gl_clear, 1, 0)
+    RHEA_EXPORT("gl.clearColor", gl_clearColor, 4, 0)
+    RHEA_EXPORT("gl.swapBuffers", gl_swapBuffers, 1, 0)
+    RHEA_EXPORT("gl.pollEvents", gl_pollEvents, 0, 0)
+    RHEA_EXPORT("gl.destroyWindow", gl_destroyWindow, 1, 0)
+    RHEA_EXPORT("gl.getMonitors", gl_getMonitors, -1, 0)
+    RHEA_EXPORT("gl.primaryMonitor", gl_primaryMonitor, -1, 0)
+    RHEA_EXPORT("gl.monitorPosition", gl_monitorPosition, 1, 0)
+    RHEA_EXPORT("gl.monitorWorkarea", gl_monitorWorkarea, 1, 0)
+    RHEA_EXPORT("gl.monitorPhysicalSize", gl_monitorPhysicalSize, 1, 0)
+    RHEA_EXPORT("gl.monitorContentScale", gl_monitorContentScale, 1, 0)
+    RHEA_EXPORT("gl.monitorName", gl_monitorName, 1, 0)
+    RHEA_EXPORT("gl.setMonitorCallback", gl_setMonitorCallback, 1, 0)
+    RHEA_EXPORT("gl.getVideoModes", gl_getVideoModes, 1, 0)
+    RHEA_EXPORT("gl.getVideoMode", gl_getVideoMode, 1, 0)
+    RHEA_EXPORT("gl.setWindowTitle", gl_setWindowTitle, 2, 0)
+    RHEA_EXPORT("gl.getWindowPos", gl_getWindowPos, 1, 0)
+    RHEA_EXPORT("gl.setWindowPos", gl_setWindowPos, 3, 0)
+    RHEA_EXPORT("gl.getWindowSize", gl_getWindowSize, 1, 0)
+    RHEA_EXPORT("gl.setWindowSize", gl_setWindowSize, 3, 0)
+    RHEA_EXPORT("gl.setWindowAspectRatio", gl_setWindowAspectRatio, 3, 0)
+    RHEA_EXPORT("gl.getWindowFrameSize", gl_getWindowFrameSize, 1, 0)
+    RHEA_EXPORT("gl.iconifyWindow", gl_iconifyWindow, 1, 0)
+    RHEA_EXPORT("gl.restoreWindow", gl_restoreWindow, 1, 0)
+    RHEA_EXPORT("gl.maximizeWindow", gl_maximizeWindow, 1, 0)
+    RHEA_EXPORT("gl.showWindow", gl_showWindow, 1, 0)
+    RHEA_EXPORT("gl.hideWindow", gl_hideWindow, 1, 0)
+    RHEA_EXPORT("gl.focusWindow", gl_focusWindow, 1, 0)
+    RHEA_EXPORT("gl.getWindowMonitor", gl_getWindowMonitor, 1, 0)
+    RHEA_EXPORT("gl.setWindowMonitor", gl_setWindowMonitor, 6, 0)
+    RHEA_EXPORT("gl.setWindowUserPointer", gl_setWindowUserPointer, 2, 0)
+    RHEA_EXPORT("gl.getWindowUserPointer", gl_getWindowUserPointer, 1, 0)
+    RHEA_EXPORT("gl.setWindowPosCallback", gl_setWindowPosCallback, 2, 0)
+    RHEA_EXPORT("gl.setWindowSizeCallback", gl_setWindowSizeCallback, 2, 0)
+    RHEA_EXPORT("gl.setWindowCloseCallback", gl_setWindowCloseCallback, 2, 0)
+    RHEA_EXPORT("gl.setWindowRefreshCallback", gl_setWindowRefreshCallback, 2,
+                0)
+    RHEA_EXPORT("gl.setWindowFocusCallback", gl_setWindowFocusCallback, 2, 0)
+    RHEA_EXPORT("gl.setWindowIconifyCallback", gl_setWindowIconifyCallback, 2,
+                0)
+    RHEA_EXPORT("gl.setWindowMaximizeCallback", gl_setWindowMaximizeCallback, 2,
+                0)
+    RHEA_EXPORT("gl.setWindowContentScaleCallback",
+                gl_setWindowContentScaleCallback, 2, 0)
+    RHEA_EXPORT("gl.setWindowAspectRatioCallback",
+                gl_setWindowAspectRatioCallback, 2, 0)
+    RHEA_EXPORT("gl.setKeyCallback", gl_setKeyCallback, 2, 0)
+    RHEA_EXPORT("gl.setCharCallback", gl_setCharCallback, 2, 0)
+    RHEA_EXPORT("gl.setCharModsCallback", gl_setCharModsCallback, 2, 0)
+    RHEA_EXPORT("gl.setMouseButtonCallback", gl_setMouseButtonCallback, 2, 0)
+    RHEA_EXPORT("gl.setCursorPosCallback", gl_setCursorPosCallback, 2, 0)
+    RHEA_EXPORT("gl.setCursorEnterCallback", gl_setCursorEnterCallback, 2, 0)
+    RHEA_EXPORT("gl.setScrollCallback", gl_setScrollCallback, 2, 0)
+    RHEA_EXPORT("gl.setDropCallback", gl_setDropCallback, 2, 0)
+    RHEA_EXPORT("gl.getKey", gl_getKey, 2, 0)
+    RHEA_EXPORT("gl.getKeyName", gl_getKeyName, 2, 0)
+    RHEA_EXPORT("gl.getKeyScancode", gl_getKeyScancode, 1, 0)
+    RHEA_EXPORT("gl.getMouseButton", gl_getMouseButton, 2, 0)
+    RHEA_EXPORT("gl.getCursorPos", gl_getCursorPos, 1, 0)
+    RHEA_EXPORT("gl.setCursorPos", gl_setCursorPos, 3, 0)
+    RHEA_EXPORT("gl.setCursorMode", gl_setCursorMode, 2, 0)
+    RHEA_EXPORT("gl.createCursor", gl_createCursor, 3, 0)
+    RHEA_EXPORT("gl.createStandardCursor", gl_createStandardCursor, 1, 0)
+    RHEA_EXPORT("gl.destroyCursor", gl_destroyCursor, 1, 0)
+    RHEA_EXPORT("gl.setCursor", gl_setCursor, 2, 0)
+    RHEA_EXPORT("gl.getJoystickPresent", gl_getJoystickPresent, 1, 0)
+    RHEA_EXPORT("gl.getJoystickAxes", gl_getJoystickAxes, 1, 0)
+    RHEA_EXPORT("gl.getJoystickButtons", gl_getJoystickButtons, 1, 0)
+    RHEA_EXPORT("gl.getJoystickHats", gl_getJoystickHats, 1, 0)
+    RHEA_EXPORT("gl.getJoystickName", gl_getJoystickName, 1, 0)
+    RHEA_EXPORT("gl.getJoystickGUID", gl_getJoystickGUID, 1, 0)
+    RHEA_EXPORT("gl.setJoystickCallback", gl_setJoystickCallback, 1, 0)
+    RHEA_EXPORT("gl.updateGamepadMappings", gl_updateGamepadMappings, 1, 0)
+    RHEA_EXPORT("gl.getGamepadName", gl_getGamepadName, 1, 0)
+    RHEA_EXPORT("gl.getGamepadState", gl_getGamepadState, 1, 0)
+    RHEA_EXPORT("gl.setClipboardString", gl_setClipboardString, 1, 0)
+    RHEA_EXPORT("gl.getClipboardString", gl_getClipboardString, -1, 0)
+    RHEA_EXPORT("gl.getTime", gl_getTime, -1, 0)
+    RHEA_EXPORT("gl.setTime", gl_setTime, 1, 0)
+    RHEA_EXPORT("gl.getTimerValue", gl_getTimerValue, -1, 0)
+    RHEA_EXPORT("gl.getTimerFrequency", gl_getTimerFrequency, -1, 0)
+    RHEA_EXPORT("gl.extensionSupported", gl_extensionSupported, 1, 0)
+    RHEA_EXPORT("gl.getProcAddress", gl_getProcAddress, 1, 0)
+#endif
+
+    RHEA_EXPORT("io.print", io_print, -1, 0)
+    RHEA_EXPORT("io.printLine", io_printLine, -1, 0)
+    RHEA_EXPORT("io.readString", io_readString, -1, 0)
+    RHEA_EXPORT("io.readNumber", io_readNumber, -1, 0)
+    RHEA_EXPORT("io.readBoolean", io_readBoolean, -1, 0)
+    RHEA_EXPORT("io.fileRead", io_fileRead, 1, 0)
+    RHEA_EXPORT("io.fileWrite", io_fileWrite, 2, 0)
+    RHEA_EXPORT("io.fileSize", io_fileSize, 1, 0)
+    RHEA_EXPORT("io.filePerms", io_filePerms, 1, 0)
+    RHEA_EXPORT("io.fileCreationDate", io_fileCreationDate, 1, 0)
+    RHEA_EXPORT("io.fileDelete", io_fileDelete, 1, 0)
+    RHEA_EXPORT("io.folderCreate", io_folderCreate, 1, 0)
+    RHEA_EXPORT("io.folderSize", io_folderSize, 1, 0)
+    RHEA_EXPORT("io.folderCreationDate", io_folderCreationDate, 1, 0)
+    RHEA_EXPORT("io.folderDelete", io_folderDelete, -1, 0)
+    RHEA_EXPORT("io.isFile", io_isFile, 1, 0)
+    RHEA_EXPORT("io.isFolder", io_isFolder, 1, 0)
+    RHEA_EXPORT("io.listAllFiles", io_listAllFiles, 1, 0)
+    RHEA_EXPORT("io.exit", io_exit, -1, 0)
+
+    RHEA_EXPORT("lang.buildPlatform", lang_buildPlatform, -1, 0)
+    RHEA_EXPORT("lang.buildType", lang_buildType, -1, 0)
+    RHEA_EXPORT("lang.buildTime", lang_buildTime, -1, 0)
+    RHEA_EXPORT("lang.version", lang_version, -1, 0)
+
+    RHEA_EXPORT("ml.trendline.calculate", ml_trendline_calculate, 2, 0)
+    RHEA_EXPORT("ml.trendline.calculateRmse", ml_trendline_calculateRmse, 3, 0)
+    RHEA_EXPORT("ml.trendline.predict", ml_trendline_predict, 2, 0)
+    RHEA_EXPORT("ml.ann.create", ml_ann_create, 3, 0)
+    RHEA_EXPORT("ml.ann.fromMnist", ml_ann_fromMnist, 4, 0)
+    RHEA_EXPORT("ml.ann.fromModelFile", ml_ann_fromModelFile, 1, 0)
+    RHEA_EXPORT("ml.ann.train", ml_ann_train, 5, 0)
+    RHEA_EXPORT("ml.ann.predict", ml_ann_predict, 2, 0)
+    RHEA_EXPORT("ml.ann.calculateMseLoss", ml_ann_calculateMseLoss, 3, 0)
+    RHEA_EXPORT("ml.ann.computeOutputGradient", ml_ann_computeOutputGradient, 3,
+                0)
+    RHEA_EXPORT("ml.ann.computeAccuracy", ml_ann_computeAccuracy, 5, 0)
+    RHEA_EXPORT("ml.ann.isCorrectPrediction", ml_ann_isCorrectPrediction, 3, 0)
+    RHEA_EXPORT("ml.ann.saveModel", ml_ann_saveModel, 2, 0)
+
+    RHEA_EXPORT("math.cos", math_cos, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.cosh", math_cosh, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.sin", math_sin, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.sinh", math_sinh, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.tan", math_tan, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.tanh", math_tanh, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.acos", math_acos, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.acosh", math_acosh, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.asin", math_asin, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.asinh", math_asinh, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.atan", math_atan, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.atan2", math_atan2, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.atanh", math_atanh, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.rand", math_rand, -1, 0)
+    RHEA_EXPORT("math.pow", math_pow, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.pow2", math_pow2, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.log", math_log, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.log10", math_log10, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.log1p", math_log1p, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.log2", math_log2, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.exp", math_exp, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.splitExponent", math_splitExponent, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.combineExponent", math_combineExponent, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.extractExponent", math_extractExponent, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.scaleByExponent", math_scaleByExponent, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.squareRoot", math_squareRoot, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.cubicRoot", math_cubicRoot, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.inverseSqrt", math_inverseSqrt, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.hypotenuse", math_hypotenuse, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.ceil", math_ceil, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.floor", math_floor, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.round", math_round, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.dim", math_dim, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.min", math_min, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.max", math_max, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.errorFunc", math_errorFunc, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.errorFuncComp", math_errorFuncComp, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.remainder", math_remainder, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.remQuotient", math_remQuotient, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.abs", math_abs, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.fusedMultiplyAdd", math_fusedMultiplyAdd, 3,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.sigmoid", math_activation_sigmoid, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.sigmoidDerivative",
+                math_activation_sigmoidDerivative, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.step", math_activation_step, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.relu", math_activation_relu, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.leakyRelu", math_activation_leakyRelu, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.elu", math_activation_elu, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.selu", math_activation_selu, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.softmax", math_activation_softmax, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.swish", math_activation_swish, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.mish", math_activation_mish, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.hardSigmoid", math_activation_hardSigmoid, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.hardTan", math_activation_hardTan, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.softplus", math_activation_softplus, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.softsign", math_activation_softsign, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.gaussian", math_activation_gaussian, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.bentIdentity", math_activation_bentIdentity, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("math.activation.logLogistic", math_activation_logLogistic, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+
+    RHEA_EXPORT("net.init", net_init, -1, 0)
+    RHEA_EXPORT("net.deinit", net_deinit, -1, 0)
+    RHEA_EXPORT("net.setCaCert", net_setCaCert, 1, 0)
+    RHEA_EXPORT("net.getCaCert", net_getCaCert, -1, 0)
+    RHEA_EXPORT("net.http.get", net_http_get, -1, 0)
+    RHEA_EXPORT("net.http.post", net_http_post, -1, 0)
+    RHEA_EXPORT("net.http.ping", net_http_ping, -1, 0)
+    RHEA_EXPORT("net.http.downloadFile", net_http_downloadFile, -1, 0)
+    RHEA_EXPORT("net.tor.get", net_tor_get, -1, 0)
+    RHEA_EXPORT("net.tor.post", net_tor_post, -1, 0)
+    RHEA_EXPORT("net.tor.ping", net_tor_ping, -1, 0)
+    RHEA_EXPORT("net.tor.downloadFile", net_tor_downloadFile, -1, 0)
+    RHEA_EXPORT("net.tor.isRunning", net_tor_isRunning, 0, 0)
+    RHEA_EXPORT("net.smtp.sendMail", net_smtp_sendMail, 7, 0)
+    RHEA_EXPORT("net.smtp.sendMailHtml", net_smtp_sendMailHtml, 7, 0)
+
+    RHEA_EXPORT("reflect.get", reflect_get, 1, 0)
+    RHEA_EXPORT("reflect.has", reflect_has, 1, 0)
+    RHEA_EXPORT("reflect.typeOf", reflect_typeOf, 1, 0)
+    RHEA_EXPORT("reflect.remove", reflect_remove, 1, 0)
+    RHEA_EXPORT("reflect.invoke", reflect_invoke, 2, 0)
+    RHEA_EXPORT("reflect.exec", reflect_exec, 1, 0)
+    RHEA_EXPORT("reflect.isTest", reflect_isTest, -1, 0)
+    RHEA_EXPORT("reflect.isUnsafe", reflect_isUnsafe, -1, 0)
+
+    RHEA_EXPORT("regex.match", regex_match, 2, 0)
+    RHEA_EXPORT("regex.isValidExpr", regex_isValidExpr, 1, 0)
+    RHEA_EXPORT("regex.escapeRegex", regex_escapeRegex, 1, 0)
+    RHEA_EXPORT("regex.search", regex_search, 2, 0)
+    RHEA_EXPORT("regex.countMatches", regex_countMatches, 2, 0)
+    RHEA_EXPORT("regex.findMatchPositions", regex_findMatchPositions, 2, 0)
+    RHEA_EXPORT("regex.findAllMatches", regex_findAllMatches, 2, 0)
+    RHEA_EXPORT("regex.replaceAll", regex_replaceAll, 3, 0)
+    RHEA_EXPORT("regex.replaceFirst", regex_replaceFirst, 3, 0)
+    RHEA_EXPORT("regex.split", regex_split, 2, 0)
+    RHEA_EXPORT("regex.getCapturedGroups", regex_getCapturedGroups, 2, 0)
+    RHEA_EXPORT("regex.getAllCapturedGroups", regex_getAllCapturedGroups, 2, 0)
+
+    RHEA_EXPORT("str.append", str_append, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.at", str_at, 2, RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.contains", str_contains, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.find", str_find, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.fromBuffer", str_fromBuffer, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.occurence", str_occurence, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.pop", str_pop, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.replace", str_replace, 3,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.replaceAll", str_replaceAll, 3,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.split", str_split, 2,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.substring", str_substring, 3,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.toArray", str_toArray, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.toBytes", str_toBytes, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("str.trim", str_trim, 1,
+                RHEA_NATIVE_PURE | RHEA_NATIVE_THREAD_SAFE)
+
+    RHEA_EXPORT("sys.quickShell", sys_quickShell, 1, 0)
+    RHEA_EXPORT("sys.shellConnect", sys_shellConnect, 1, 0)
+    RHEA_EXPORT("sys.shellWrite", sys_shellWrite, 2, 0)
+    RHEA_EXPORT("sys.shellReadOutput", sys_shellReadOutput, 1, 0)
+    RHEA_EXPORT("sys.shellReadError", sys_shellReadError, 1, 0)
+    RHEA_EXPORT("sys.shellForceExit", sys_shellForceExit, 1, 0)
+    RHEA_EXPORT("sys.shellHasExited", sys_shellHasExited, 1, 0)
+    RHEA_EXPORT("sys.shellExitCode", sys_shellExitCode, 1, 0)
+    RHEA_EXPORT("sys.shellProcessId", sys_shellProcessId, 1, 0)
+    RHEA_EXPORT("sys.shellClose", sys_shellClose, 1, 0)
+    RHEA_EXPORT("sys.arch", sys_arch, -1, 0)
+    RHEA_EXPORT("sys.platform", sys_platform, -1, 0)
+    RHEA_EXPORT("sys.wordSize", sys_wordSize, -1, 0)
+    RHEA_EXPORT("sys.endianess", sys_endianess, -1, 0)
+    RHEA_EXPORT("sys.cpuFeatures", sys_cpuFeatures, -1, 0)
+    RHEA_EXPORT("sys.sleep", sys_sleep, 1, 0)
+
+    RHEA_EXPORT("thread.create", thread_create, -1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.join", thread_join, 1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.detach", thread_detach, 1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.sleep", thread_sleep, 1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.yield", thread_yield, -1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.id", thread_id, -1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.exit", thread_exit, -1, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.mutex.create", thread_mutex_create, -1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.mutex.lockMut", thread_mutex_lockMut, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.mutex.tryLock", thread_mutex_tryLock, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.mutex.unlock", thread_mutex_unlock, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.mutex.destroy", thread_mutex_destroy, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.condition.create", thread_condition_create, -1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.condition.hold", thread_condition_hold, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.condition.signal", thread_condition_signal, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.condition.broadcast", thread_condition_broadcast, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.condition.destroy", thread_condition_destroy, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.create", thread_atomic_create, -1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.load", thread_atomic_load, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.store", thread_atomic_store, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.fetchAdd", thread_atomic_fetchAdd, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.compareExchange",
+                thread_atomic_compareExchange, 3, RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.min", thread_atomic_min, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.max", thread_atomic_max, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.atomic.destroy", thread_atomic_destroy, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.create", thread_channel_create, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.send", thread_channel_send, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.trySend", thread_channel_trySend, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.sendBatch", thread_channel_sendBatch, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.recv", thread_channel_recv, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.tryRecv", thread_channel_tryRecv, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.recvBatch", thread_channel_recvBatch, 2,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.select", thread_channel_select, -1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.close", thread_channel_close, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.isClosed", thread_channel_isClosed, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+    RHEA_EXPORT("thread.channel.destroy", thread_channel_destroy, 1,
+                RHEA_NATIVE_THREAD_SAFE)
+
+    RHEA_EXPORT("unsafe.volatileRead8", unsafe_volatileRead8, 1, 0)
+    RHEA_EXPORT("unsafe.volatileRead16", unsafe_volatileRead16, 1, 0)
+    RHEA_EXPORT("unsafe.volatileRead32", unsafe_volatileRead32, 1, 0)
+    RHEA_EXPORT("unsafe.volatileWrite8", unsafe_volatileWrite8, 2, 0)
+    RHEA_EXPORT("unsafe.volatileWrite16", unsafe_volatileWrite16, 2, 0)
+    RHEA_EXPORT("unsafe.volatileWrite32", unsafe_volatileWrite32, 2, 0)
+    RHEA_EXPORT("unsafe.registerSetBits", unsafe_registerSetBits, 2, 0)
+    RHEA_EXPORT("unsafe.registerClearBits", unsafe_registerClearBits, 2, 0)
+    RHEA_EXPORT("unsafe.registerToggleBits", unsafe_registerToggleBits, 2, 0)
+    RHEA_EXPORT("unsafe.registerTestBits", unsafe_registerTestBits, 2, 0)
+    RHEA_EXPORT("unsafe.registerReadField", unsafe_registerReadField, 3, 0)
+    RHEA_EXPORT("unsafe.registerWriteField", unsafe_registerWriteField, 4, 0)
+    RHEA_EXPORT("unsafe.memoryBarrier", unsafe_memoryBarrier, -1, 0)
+    RHEA_EXPORT("unsafe.readBarrier", unsafe_readBarrier, -1, 0)
+    RHEA_EXPORT("unsafe.writeBarrier", unsafe_writeBarrier, -1, 0)
+    RHEA_EXPORT("unsafe.memoryFenceAcquire", unsafe_memoryFenceAcquire, -1, 0)
+    RHEA_EXPORT("unsafe.memoryFenceRelease", unsafe_memoryFenceRelease, -1, 0)
+    RHEA_EXPORT("unsafe.memoryFenceSequential",
+                unsafe_memoryFenceSequential, -1, 0)
+    RHEA_EXPORT("unsafe.enableInterrupts", unsafe_enableInterrupts, -1, 0)
+    RHEA_EXPORT("unsafe.disableInterrupts", unsafe_disableInterrupts, -1, 0)
+    RHEA_EXPORT("unsafe.setCpuAffinity", unsafe_setCpuAffinity, 1, 0)
+    RHEA_EXPORT("unsafe.portRead8", unsafe_portRead8, 1, 0)
+    RHEA_EXPORT("unsafe.portRead16", unsafe_portRead16, 1, 0)
+    RHEA_EXPORT("unsafe.portRead32", unsafe_portRead32, 1, 0)
+    RHEA_EXPORT("unsafe.portWrite8", unsafe_portWrite8, 2, 0)
+    RHEA_EXPORT("unsafe.portWrite16", unsafe_portWrite16, 2, 0)
+    RHEA_EXPORT("unsafe.portWrite32", unsafe_portWrite32, 2, 0)
+    RHEA_EXPORT("unsafe.inject", unsafe_inject, 2, 0)
+
+RHEA_MODULE_END
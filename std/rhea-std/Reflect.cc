@@ -23,6 +23,7 @@
 #include <rhea/core/Runtime.hpp>
 #include <rhea/parser/Parser.hpp>
 #include <rhea/parser/ParserException.hpp>
+#include <rhea/parser/SymbolResolver.hpp>
 #include <rhea/parser/Tokenizer.hpp>
 #include <rhea/util/Render.hpp>
 
@@ -108,10 +109,8 @@ RHEA_FUNC(reflect_exec) {
         Parser parser(tokenizer.getTokens());
         parser.parse();
 
-        DynamicObject value;
-        for(const auto& statement : parser.getGlobalStatements())
-            value = statement->visit(symtab);
-        return value;
+        SymbolResolver::resolve(parser.getGlobalStatements(), symtab, true);
+        return Runtime::evaluate(symtab, parser.getGlobalStatements());
     } catch(const std::system_error& exc) {
         symtab.waitForTasks();
         Runtime::cleanUp();
@@ -22,13 +22,15 @@
 #include <fstream>
 #include <myshell.hpp>
 #include <rhea/ast/TerminativeSignal.hpp>
-#include <rhea/util/RandomUtil.hpp>
-#include <unordered_map>
 
 #if defined(_WIN32) || defined(_WIN64) || defined(WIN32) || defined(WIN64)
 #include <windows.h>
 #endif
 
+static const HandleKind shellKind{"shell", [](void* object) {
+                                      delete static_cast<MyShell*>(object);
+                                  }};
+
 RHEA_FUNC(sys_quickShell) {
     RHEA_FUNC_REQUIRE_UNSAFE
     if(args.size() != 1)
@@ -48,10 +50,7 @@ RHEA_FUNC(sys_shellConnect) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = RheaUtil::uniqueKey();
-
-    shellMap[uuid] = std::make_shared<MyShell>(value.toString());
-    return DynamicObject(uuid);
+    return HandleTable::create(shellKind, new MyShell(value.toString()));
 }
 
 RHEA_FUNC(sys_shellWrite) {
@@ -62,14 +61,10 @@ RHEA_FUNC(sys_shellWrite) {
             "Expecting 2 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0), content = args.at(1);
-    std::string uuid = value.toString();
-
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    shellMap[uuid]->writeToShell(content.toString());
-    return DynamicObject(uuid);
+    shell->writeToShell(content.toString());
+    return value;
 }
 
 RHEA_FUNC(sys_shellReadOutput) {
@@ -80,13 +75,9 @@ RHEA_FUNC(sys_shellReadOutput) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
-
-    return DynamicObject(shellMap[uuid]->readShellOutputStream());
+    return DynamicObject(shell->readShellOutputStream());
 }
 
 RHEA_FUNC(sys_shellReadError) {
@@ -97,13 +88,9 @@ RHEA_FUNC(sys_shellReadError) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
-
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    return DynamicObject(shellMap[uuid]->readShellErrorStream());
+    return DynamicObject(shell->readShellErrorStream());
 }
 
 RHEA_FUNC(sys_shellForceExit) {
@@ -114,14 +101,10 @@ RHEA_FUNC(sys_shellForceExit) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
-
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    shellMap[uuid]->forceExit();
-    return DynamicObject(uuid);
+    shell->forceExit();
+    return value;
 }
 
 RHEA_FUNC(sys_shellHasExited) {
@@ -132,13 +115,9 @@ RHEA_FUNC(sys_shellHasExited) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
-
-    return DynamicObject(shellMap[uuid]->hasExited());
+    return DynamicObject(shell->hasExited());
 }
 
 RHEA_FUNC(sys_shellExitCode) {
@@ -149,13 +128,9 @@ RHEA_FUNC(sys_shellExitCode) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
-
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    return DynamicObject(static_cast<double>(shellMap[uuid]->exitCode()));
+    return DynamicObject(static_cast<double>(shell->exitCode()));
 }
 
 RHEA_FUNC(sys_shellProcessId) {
@@ -166,13 +141,9 @@ RHEA_FUNC(sys_shellProcessId) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
-
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
+    MyShell* shell = findHandle<MyShell>(address, value, shellKind);
 
-    return DynamicObject(static_cast<double>(shellMap[uuid]->processId()));
+    return DynamicObject(static_cast<double>(shell->processId()));
 }
 
 RHEA_FUNC(sys_shellClose) {
@@ -183,14 +154,8 @@ RHEA_FUNC(sys_shellClose) {
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
     DynamicObject value = args.at(0);
-    std::string uuid = value.toString();
-
-    if(shellMap.count(uuid) != 1)
-        throw TerminativeThrowSignal(std::move(address),
-                                     "Shell handler not found");
-
-    shellMap.erase(uuid);
-    return DynamicObject(uuid);
+    delete takeHandle<MyShell>(address, value, shellKind);
+    return value;
 }
 
 RHEA_FUNC(sys_arch) {
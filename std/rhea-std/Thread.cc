@@ -19,37 +19,340 @@
 #include "rhea-std/Thread.hpp"
 
 #include <Rhea.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <rhea/ast/TerminativeSignal.hpp>
 #include <rhea/ast/expression/FunctionDeclarationExpression.hpp>
-#include <rhea/util/RandomUtil.hpp>
+#include <rhea/core/TaskScheduler.hpp>
 #include <thread>
-#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Whole numbers are kept in a 64-bit integer so counters stay exact past
+// 2^53 increments; anything else is kept as a double.
+class AtomicNumber final {
+   public:
+    bool integral;
+    std::atomic<int64_t> whole;
+    std::atomic<double> real;
+
+    explicit AtomicNumber(double value)
+        : integral(std::trunc(value) >= value && std::trunc(value) <= value),
+          whole(this->integral ? static_cast<int64_t>(value) : 0),
+          real(this->integral ? 0.0 : value) {
+    }
+};
+
+// Bounded multi-producer multi-consumer ring after Dmitry Vyukov's queue:
+// every cell carries a sequence number that tells producers and consumers
+// whose turn it is, so neither side takes a lock. Blocked callers park on
+// the channel's event word. Select waits on a condition variable shared by
+// all channels, which lets it bound the wait by its timeout.
+class Channel final {
+   private:
+    class Cell final {
+       public:
+        std::atomic<size_t> sequence;
+        DynamicObject value;
+
+        Cell() : sequence(0), value() {
+        }
+    };
+
+    size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<size_t> head;
+    alignas(64) std::atomic<size_t> tail;
+    alignas(64) std::atomic<uint32_t> events;
+    std::atomic<uint32_t> waiters;
+    std::atomic<bool> closed;
+
+    static inline std::atomic<uint32_t> selectEvents = 0;
+    static inline std::atomic<uint32_t> selectWaiters = 0;
+    static inline std::mutex selectLock;
+    static inline std::condition_variable selectWakeup;
+
+    void park(uint32_t observed) {
+        this->waiters.fetch_add(1);
+        if(this->events.load() == observed && !this->isClosed()) {
+            TaskScheduler::Blocking blocking;
+            this->events.wait(observed);
+        }
+        this->waiters.fetch_sub(1);
+    }
+
+   public:
+    explicit Channel(size_t capacity)
+        : mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+          cells(new Cell[this->mask + 1]),
+          head(0),
+          tail(0),
+          events(0),
+          waiters(0),
+          closed(false) {
+        for(size_t i = 0; i <= this->mask; i++)
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    bool isClosed() const {
+        return this->closed.load(std::memory_order_acquire);
+    }
+
+    void signal() {
+        this->events.fetch_add(1);
+        if(this->waiters.load() != 0) this->events.notify_all();
+
+        // Taking the lock after the bump keeps a select that just saw the
+        // old count from missing the wakeup.
+        if(Channel::selectWaiters.load() != 0) {
+            Channel::selectEvents.fetch_add(1);
+            {
+                std::lock_guard<std::mutex> lock(Channel::selectLock);
+            }
+            Channel::selectWakeup.notify_all();
+        }
+    }
+
+    bool trySend(DynamicObject& value) {
+        size_t position = this->head.load(std::memory_order_relaxed);
+
+        for(;;) {
+            Cell& cell = this->cells[position & this->mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+            if(sequence == position) {
+                if(this->head.compare_exchange_weak(
+                       position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(position + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if(sequence < position)
+                return false;
+            else
+                position = this->head.load(std::memory_order_relaxed);
+        }
+    }
+
+    bool tryRecv(DynamicObject& value) {
+        size_t position = this->tail.load(std::memory_order_relaxed);
+
+        for(;;) {
+            Cell& cell = this->cells[position & this->mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+            if(sequence == position + 1) {
+                if(this->tail.compare_exchange_weak(
+                       position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.value = {};
+                    cell.sequence.store(position + this->mask + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if(sequence < position + 1)
+                return false;
+            else
+                position = this->tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    bool send(DynamicObject& value) {
+        for(;;) {
+            if(this->isClosed()) return false;
+
+            uint32_t observed = this->events.load();
+            if(this->trySend(value)) {
+                this->signal();
+                return true;
+            }
+
+            this->park(observed);
+        }
+    }
+
+    bool recv(DynamicObject& value) {
+        for(;;) {
+            uint32_t observed = this->events.load();
+            if(this->tryRecv(value)) {
+                this->signal();
+                return true;
+            }
+
+            if(this->isClosed()) {
+                if(!this->tryRecv(value)) return false;
+
+                this->signal();
+                return true;
+            }
+
+            this->park(observed);
+        }
+    }
+
+    void close() {
+        this->closed.store(true, std::memory_order_release);
+        this->signal();
+    }
+
+    // Receives from whichever channel has a value first, returning its
+    // index, or -1 once every channel is closed and drained or the
+    // timeout (when not negative, in milliseconds) runs out.
+    static long select(const std::vector<Channel*>& channels,
+                       DynamicObject& value, double timeout) {
+        auto deadline =
+            std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double, std::milli>(timeout));
+        long index = -1;
+        std::optional<TaskScheduler::Blocking> blocking;
+
+        // Registered before the first scan, so no send can slip in between
+        // a scan and the wait without bumping the select event word.
+        Channel::selectWaiters.fetch_add(1);
+        while(index < 0) {
+            uint32_t observed = Channel::selectEvents.load();
+            bool open = false;
+
+            for(size_t i = 0; i < channels.size() && index < 0; i++) {
+                if(channels[i]->tryRecv(value)) {
+                    channels[i]->signal();
+                    index = static_cast<long>(i);
+                }
+
+                open = open || !channels[i]->isClosed();
+            }
+
+            if(index >= 0 || !open ||
+               (timeout >= 0 && std::chrono::steady_clock::now() >= deadline))
+                break;
+
+            if(!blocking) blocking.emplace();
+            auto changed = [observed]() {
+                return Channel::selectEvents.load() != observed;
+            };
+
+            std::unique_lock<std::mutex> lock(Channel::selectLock);
+            if(timeout < 0)
+                Channel::selectWakeup.wait(lock, changed);
+            else
+                Channel::selectWakeup.wait_until(lock, deadline, changed);
+        }
+        Channel::selectWaiters.fetch_sub(1);
+
+        return index;
+    }
+};
+
+// A thread handle outlives the task's own references to it, so join can
+// still collect the result; thread.exit only marks the handle as dropped.
+class ThreadState final {
+   public:
+    std::shared_ptr<Task> task;
+    std::atomic<bool> detached;
+
+    ThreadState() : task(nullptr), detached(false) {
+    }
+};
+
+static thread_local ThreadState* runningThread = nullptr;
+
+class RunningThread final {
+   private:
+    ThreadState* previous;
+
+   public:
+    explicit RunningThread(ThreadState* state)
+        : previous(std::exchange(runningThread, state)) {
+    }
+
+    ~RunningThread() {
+        runningThread = this->previous;
+    }
+
+    RunningThread(const RunningThread&) = delete;
+    RunningThread& operator=(const RunningThread&) = delete;
+};
+
+static const HandleKind threadKind{"thread", [](void* object) {
+                                       delete static_cast<
+                                           std::shared_ptr<ThreadState>*>(
+                                           object);
+                                   }};
 
-static std::unordered_map<std::string, std::thread*> threadMap;
-static std::unordered_map<std::string, std::mutex*> mutexMap;
-static std::unordered_map<std::string, std::condition_variable*> conditionMap;
-static std::mutex threadMapMutex;
-static std::mutex mutexMapMutex;
-static std::mutex conditionMapMutex;
+static const HandleKind mutexKind{"mutex", [](void* object) {
+                                      delete static_cast<std::mutex*>(object);
+                                  }};
+
+static const HandleKind conditionKind{
+    "condition", [](void* object) {
+        delete static_cast<std::condition_variable*>(object);
+    }};
+
+static const HandleKind atomicKind{"atomic", [](void* object) {
+                                       delete static_cast<AtomicNumber*>(
+                                           object);
+                                   }};
+
+static const HandleKind channelKind{"channel", [](void* object) {
+                                        delete static_cast<Channel*>(object);
+                                    }};
 
 RHEA_FUNC(thread_create) {
-    if(args.size() != 0)
+    if(args.empty())
         throw TerminativeThrowSignal(
             std::move(address),
-            "Expecting 0 arguments, got " + std::to_string(args.size()));
+            "Expecting at least 1 argument, got " +
+                std::to_string(args.size()));
 
-    std::string key = RheaUtil::uniqueKey();
-    std::thread* newThread = new std::thread([]() {});
+    DynamicObject callback = args.at(0);
+    if(!callback.isFunction())
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Thread body should be of function type, got " +
+                callback.objectType());
+
+    // Threads are tasks on the runtime's worker pool, so starting one is a
+    // queue push; the body sees a snapshot of the caller's scope, just
+    // like a `parallel` expression. Natives that park the body hand its
+    // worker over to a spare while they wait.
+    std::vector<DynamicObject> arguments(args.begin() + 1, args.end());
+    std::shared_ptr<ThreadState> state = std::make_shared<ThreadState>();
+
+    state->task = TaskScheduler::getInstance().submit(
+        [function = callback.getCallable(), arguments = std::move(arguments),
+         symbols = symtab, state]() mutable {
+            RunningThread running(state.get());
+            return function->call(symbols, arguments);
+        });
+
+    return HandleTable::create(
+        threadKind, new std::shared_ptr<ThreadState>(std::move(state)));
+}
 
-    {
-        std::lock_guard<std::mutex> lock(threadMapMutex);
-        threadMap[key] = newThread;
-    }
+static std::shared_ptr<Task> releaseThread(std::shared_ptr<Token>& address,
+                                           const DynamicObject& handle) {
+    std::unique_ptr<std::shared_ptr<ThreadState>> state(
+        takeHandle<std::shared_ptr<ThreadState>>(address, handle,
+                                                 threadKind));
 
-    return DynamicObject(key);
+    if((*state)->detached.load())
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Invalid thread handle");
+    return (*state)->task;
 }
 
 RHEA_FUNC(thread_join) {
@@ -58,21 +361,10 @@ RHEA_FUNC(thread_join) {
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    std::shared_ptr<Task> task = releaseThread(address, args.at(0));
+    TaskScheduler::getInstance().wait(task);
 
-    std::thread* threadPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(threadMapMutex);
-        if(threadMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Thread key does not exist");
-        threadPtr = threadMap[keyStr];
-    }
-
-    if(threadPtr && threadPtr->joinable()) threadPtr->join();
-
-    return {};
+    return task->get();
 }
 
 RHEA_FUNC(thread_detach) {
@@ -81,20 +373,7 @@ RHEA_FUNC(thread_detach) {
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
-
-    std::thread* threadPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(threadMapMutex);
-        if(threadMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Thread key does not exist");
-        threadPtr = threadMap[keyStr];
-    }
-
-    if(threadPtr && threadPtr->joinable()) threadPtr->detach();
-
+    releaseThread(address, args.at(0));
     return {};
 }
 
@@ -109,6 +388,7 @@ RHEA_FUNC(thread_sleep) {
         throw TerminativeThrowSignal(std::move(address),
                                      "Milliseconds must be a number");
 
+    TaskScheduler::Blocking blocking;
     std::this_thread::sleep_for(
         std::chrono::milliseconds(static_cast<int>(milliseconds.getNumber())));
 
@@ -127,250 +407,469 @@ RHEA_FUNC(thread_id) {
 }
 
 RHEA_FUNC(thread_exit) {
-    std::thread* currentThread = nullptr;
-    std::string currentKey;
+    if(runningThread != nullptr) runningThread->detached.store(true);
+    return {};
+}
 
-    {
-        std::lock_guard<std::mutex> lock(threadMapMutex);
-        for(auto& pair : threadMap) {
-            if(pair.second->get_id() == std::this_thread::get_id()) {
-                currentThread = pair.second;
-                currentKey = pair.first;
-                break;
-            }
-        }
-    }
+RHEA_FUNC(thread_mutex_create) {
+    return HandleTable::create(mutexKind, new std::mutex());
+}
 
-    if(currentThread) {
-        currentThread->detach();
-        delete currentThread;
+RHEA_FUNC(thread_mutex_lockMut) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
 
-        std::lock_guard<std::mutex> lock(threadMapMutex);
-        threadMap.erase(currentKey);
+    std::mutex* mutex = findHandle<std::mutex>(address, args.at(0), mutexKind);
+    if(!mutex->try_lock()) {
+        TaskScheduler::Blocking blocking;
+        mutex->lock();
     }
 
     return {};
 }
 
-RHEA_FUNC(thread_mutex_create) {
-    std::string key = RheaUtil::uniqueKey();
-    std::mutex* newMutex = new std::mutex();
+RHEA_FUNC(thread_mutex_tryLock) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    {
-        std::lock_guard<std::mutex> lock(mutexMapMutex);
-        mutexMap[key] = newMutex;
-    }
+    return DynamicObject(
+        findHandle<std::mutex>(address, args.at(0), mutexKind)->try_lock());
+}
+
+RHEA_FUNC(thread_mutex_unlock) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
+
+    findHandle<std::mutex>(address, args.at(0), mutexKind)->unlock();
 
-    return DynamicObject(key);
+    return {};
 }
 
-RHEA_FUNC(thread_mutex_lockMut) {
+RHEA_FUNC(thread_mutex_destroy) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    closeHandle<std::mutex>(address, args.at(0), mutexKind);
 
-    std::mutex* mutexPtr = nullptr;
+    return {};
+}
+
+RHEA_FUNC(thread_condition_create) {
+    return HandleTable::create(conditionKind, new std::condition_variable());
+}
+
+RHEA_FUNC(thread_condition_hold) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    std::condition_variable* condPtr = findHandle<std::condition_variable>(
+        address, args.at(0), conditionKind);
+    std::mutex* mutexPtr =
+        findHandle<std::mutex>(address, args.at(1), mutexKind);
+
+    std::unique_lock<std::mutex> lock(*mutexPtr, std::adopt_lock);
     {
-        std::lock_guard<std::mutex> lock(mutexMapMutex);
-        if(mutexMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Mutex key does not exist");
-        mutexPtr = mutexMap[keyStr];
+        TaskScheduler::Blocking blocking;
+        condPtr->wait(lock);
     }
-
-    if(mutexPtr) mutexPtr->lock();
+    lock.release();
 
     return {};
 }
 
-RHEA_FUNC(thread_mutex_tryLock) {
+RHEA_FUNC(thread_condition_signal) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    findHandle<std::condition_variable>(address, args.at(0), conditionKind)
+        ->notify_one();
 
-    std::mutex* mutexPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(mutexMapMutex);
-        if(mutexMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Mutex key does not exist");
-        mutexPtr = mutexMap[keyStr];
-    }
+    return {};
+}
+
+RHEA_FUNC(thread_condition_broadcast) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    if(mutexPtr) return DynamicObject(mutexPtr->try_lock());
+    findHandle<std::condition_variable>(address, args.at(0), conditionKind)
+        ->notify_all();
 
-    return DynamicObject(false);
+    return {};
 }
 
-RHEA_FUNC(thread_mutex_unlock) {
+RHEA_FUNC(thread_condition_destroy) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    closeHandle<std::condition_variable>(address, args.at(0), conditionKind);
 
-    std::mutex* mutexPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(mutexMapMutex);
-        if(mutexMap.count(keyStr) == 0)
+    return {};
+}
+
+static AtomicNumber* findAtomic(std::shared_ptr<Token>& address,
+                                const DynamicObject& handle) {
+    return findHandle<AtomicNumber>(address, handle, atomicKind);
+}
+
+static double atomicOperand(std::shared_ptr<Token>& address,
+                            const AtomicNumber& atomic,
+                            const DynamicObject& value) {
+    if(!value.isNumber())
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Atomic value must be a number");
+
+    double number = value.getNumber();
+    if(atomic.integral &&
+       (std::trunc(number) < number || std::trunc(number) > number))
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Whole number atomic cannot hold a fractional value");
+
+    return number;
+}
+
+static double atomicValue(const AtomicNumber& atomic) {
+    return atomic.integral ? static_cast<double>(atomic.whole.load())
+                           : atomic.real.load();
+}
+
+template <typename T, typename Pick>
+static T atomicExchangeIf(std::atomic<T>& target, T value, Pick pick) {
+    T previous = target.load(std::memory_order_relaxed);
+    while(pick(value, previous) &&
+          !target.compare_exchange_weak(previous, value))
+        ;
+
+    return previous;
+}
+
+RHEA_FUNC(thread_atomic_create) {
+    if(args.size() > 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting at most 1 argument, got " +
+                std::to_string(args.size()));
+
+    double initial = 0.0;
+    if(args.size() == 1) {
+        if(!args.at(0).isNumber())
             throw TerminativeThrowSignal(std::move(address),
-                                         "Mutex key does not exist");
-        mutexPtr = mutexMap[keyStr];
+                                         "Atomic value must be a number");
+        initial = args.at(0).getNumber();
     }
 
-    if(mutexPtr) mutexPtr->unlock();
-
-    return {};
+    return HandleTable::create(atomicKind, new AtomicNumber(initial));
 }
 
-RHEA_FUNC(thread_mutex_destroy) {
+RHEA_FUNC(thread_atomic_load) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    return DynamicObject(atomicValue(*findAtomic(address, args.at(0))));
+}
 
-    std::mutex* mutexPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(mutexMapMutex);
-        if(mutexMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Mutex key does not exist");
-        mutexPtr = mutexMap[keyStr];
-        mutexMap.erase(keyStr);
-    }
+RHEA_FUNC(thread_atomic_store) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    AtomicNumber* atomic = findAtomic(address, args.at(0));
+    double value = atomicOperand(address, *atomic, args.at(1));
 
-    if(mutexPtr) delete mutexPtr;
+    if(atomic->integral)
+        atomic->whole.store(static_cast<int64_t>(value));
+    else
+        atomic->real.store(value);
 
     return {};
 }
 
-RHEA_FUNC(thread_condition_create) {
-    std::string key = RheaUtil::uniqueKey();
-    std::condition_variable* newCondition = new std::condition_variable();
+RHEA_FUNC(thread_atomic_fetchAdd) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
 
-    {
-        std::lock_guard<std::mutex> lock(conditionMapMutex);
-        conditionMap[key] = newCondition;
+    AtomicNumber* atomic = findAtomic(address, args.at(0));
+    double delta = atomicOperand(address, *atomic, args.at(1));
+
+    if(atomic->integral)
+        return DynamicObject(static_cast<double>(
+            atomic->whole.fetch_add(static_cast<int64_t>(delta))));
+
+    return DynamicObject(atomic->real.fetch_add(delta));
+}
+
+RHEA_FUNC(thread_atomic_compareExchange) {
+    if(args.size() != 3)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 3 arguments, got " + std::to_string(args.size()));
+
+    AtomicNumber* atomic = findAtomic(address, args.at(0));
+    double expected = atomicOperand(address, *atomic, args.at(1)),
+           desired = atomicOperand(address, *atomic, args.at(2));
+
+    if(atomic->integral) {
+        int64_t current = static_cast<int64_t>(expected);
+        return DynamicObject(atomic->whole.compare_exchange_strong(
+            current, static_cast<int64_t>(desired)));
     }
 
-    return DynamicObject(key);
+    return DynamicObject(
+        atomic->real.compare_exchange_strong(expected, desired));
 }
 
-RHEA_FUNC(thread_condition_hold) {
+RHEA_FUNC(thread_atomic_min) {
     if(args.size() != 2)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 2 arguments, got " + std::to_string(args.size()));
 
-    DynamicObject condKey = args.at(0), mutexKey = args.at(1);
-    std::string condStr = condKey.toString(), mutexStr = mutexKey.toString();
+    AtomicNumber* atomic = findAtomic(address, args.at(0));
+    double value = atomicOperand(address, *atomic, args.at(1));
+    auto lower = [](auto next, auto current) { return next < current; };
 
-    std::condition_variable* condPtr = nullptr;
-    std::mutex* mutexPtr = nullptr;
+    if(atomic->integral)
+        return DynamicObject(static_cast<double>(atomicExchangeIf(
+            atomic->whole, static_cast<int64_t>(value), lower)));
 
-    {
-        std::lock_guard<std::mutex> lockCond(conditionMapMutex);
-        std::lock_guard<std::mutex> lockMutex(mutexMapMutex);
+    return DynamicObject(atomicExchangeIf(atomic->real, value, lower));
+}
 
-        if(conditionMap.count(condStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Condition key does not exist");
-        if(mutexMap.count(mutexStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Mutex key does not exist");
+RHEA_FUNC(thread_atomic_max) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
 
-        condPtr = conditionMap[condStr];
-        mutexPtr = mutexMap[mutexStr];
-    }
+    AtomicNumber* atomic = findAtomic(address, args.at(0));
+    double value = atomicOperand(address, *atomic, args.at(1));
+    auto higher = [](auto next, auto current) { return next > current; };
 
-    if(condPtr && mutexPtr) {
-        std::unique_lock<std::mutex> lock(*mutexPtr, std::adopt_lock);
-        condPtr->wait(lock);
-        lock.release();
-    }
+    if(atomic->integral)
+        return DynamicObject(static_cast<double>(atomicExchangeIf(
+            atomic->whole, static_cast<int64_t>(value), higher)));
+
+    return DynamicObject(atomicExchangeIf(atomic->real, value, higher));
+}
+
+RHEA_FUNC(thread_atomic_destroy) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
+
+    closeHandle<AtomicNumber>(address, args.at(0), atomicKind);
 
     return {};
 }
 
-RHEA_FUNC(thread_condition_signal) {
+static Channel* findChannel(std::shared_ptr<Token>& address,
+                            const DynamicObject& handle) {
+    return findHandle<Channel>(address, handle, channelKind);
+}
+
+RHEA_FUNC(thread_channel_create) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    DynamicObject capacity = args.at(0);
+    if(!capacity.isNumber() || capacity.getNumber() < 1)
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Capacity must be a positive number");
 
-    std::condition_variable* condPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(conditionMapMutex);
-        if(conditionMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Condition key does not exist");
-        condPtr = conditionMap[keyStr];
-    }
+    return HandleTable::create(
+        channelKind, new Channel(static_cast<size_t>(capacity.getNumber())));
+}
 
-    if(condPtr) condPtr->notify_one();
+RHEA_FUNC(thread_channel_send) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    DynamicObject value = args.at(1);
+    if(!findChannel(address, args.at(0))->send(value))
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Channel is closed");
 
     return {};
 }
 
-RHEA_FUNC(thread_condition_broadcast) {
+RHEA_FUNC(thread_channel_trySend) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    Channel* channel = findChannel(address, args.at(0));
+    DynamicObject value = args.at(1);
+
+    if(channel->isClosed() || !channel->trySend(value))
+        return DynamicObject(false);
+
+    channel->signal();
+    return DynamicObject(true);
+}
+
+RHEA_FUNC(thread_channel_sendBatch) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    Channel* channel = findChannel(address, args.at(0));
+    DynamicObject values = args.at(1);
+
+    if(!values.isArray())
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Values to send must be an array");
+
+    double sent = 0;
+    for(DynamicObject value : *values.getArray()) {
+        if(!channel->send(value)) break;
+        sent++;
+    }
+
+    return DynamicObject(sent);
+}
+
+RHEA_FUNC(thread_channel_recv) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    DynamicObject value;
+    findChannel(address, args.at(0))->recv(value);
 
-    std::condition_variable* condPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(conditionMapMutex);
-        if(conditionMap.count(keyStr) == 0)
+    return value;
+}
+
+RHEA_FUNC(thread_channel_tryRecv) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    Channel* channel = findChannel(address, args.at(0));
+    DynamicObject value;
+
+    if(!channel->tryRecv(value)) return args.at(1);
+
+    channel->signal();
+    return value;
+}
+
+RHEA_FUNC(thread_channel_recvBatch) {
+    if(args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 2 arguments, got " + std::to_string(args.size()));
+
+    Channel* channel = findChannel(address, args.at(0));
+    DynamicObject limit = args.at(1);
+
+    if(!limit.isNumber() || limit.getNumber() < 1)
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Batch size must be a positive number");
+
+    auto values = std::make_shared<std::vector<DynamicObject>>();
+    size_t count = static_cast<size_t>(limit.getNumber());
+    DynamicObject value;
+
+    // Block for the first value only, then take whatever is ready.
+    if(channel->recv(value)) {
+        values->push_back(std::move(value));
+
+        while(values->size() < count && channel->tryRecv(value))
+            values->push_back(std::move(value));
+
+        if(values->size() > 1) channel->signal();
+    }
+
+    return DynamicObject(values);
+}
+
+RHEA_FUNC(thread_channel_select) {
+    if(args.size() != 1 && args.size() != 2)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 or 2 arguments, got " + std::to_string(args.size()));
+
+    DynamicObject keys = args.at(0);
+    if(!keys.isArray())
+        throw TerminativeThrowSignal(std::move(address),
+                                     "Channels to select must be an array");
+
+    double timeout = -1;
+    if(args.size() == 2) {
+        if(!args.at(1).isNumber())
             throw TerminativeThrowSignal(std::move(address),
-                                         "Condition key does not exist");
-        condPtr = conditionMap[keyStr];
+                                         "Timeout must be a number");
+        timeout = args.at(1).getNumber();
     }
 
-    if(condPtr) condPtr->notify_all();
+    std::vector<Channel*> channels;
+    for(const DynamicObject& key : *keys.getArray())
+        channels.push_back(findChannel(address, key));
+
+    DynamicObject value;
+    long index = Channel::select(channels, value, timeout);
+
+    return DynamicObject(std::make_shared<std::vector<DynamicObject>>(
+        std::vector<DynamicObject>{
+            DynamicObject(static_cast<double>(index)), std::move(value)}));
+}
+
+RHEA_FUNC(thread_channel_close) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
 
+    findChannel(address, args.at(0))->close();
     return {};
 }
 
-RHEA_FUNC(thread_condition_destroy) {
+RHEA_FUNC(thread_channel_isClosed) {
     if(args.size() != 1)
         throw TerminativeThrowSignal(
             std::move(address),
             "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    DynamicObject key = args.at(0);
-    std::string keyStr = key.toString();
+    return DynamicObject(findChannel(address, args.at(0))->isClosed());
+}
 
-    std::condition_variable* condPtr = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(conditionMapMutex);
-        if(conditionMap.count(keyStr) == 0)
-            throw TerminativeThrowSignal(std::move(address),
-                                         "Condition key does not exist");
-        condPtr = conditionMap[keyStr];
-        conditionMap.erase(keyStr);
-    }
+RHEA_FUNC(thread_channel_destroy) {
+    if(args.size() != 1)
+        throw TerminativeThrowSignal(
+            std::move(address),
+            "Expecting 1 argument, got " + std::to_string(args.size()));
 
-    if(condPtr) delete condPtr;
+    closeHandle<Channel>(address, args.at(0), channelKind)->close();
 
     return {};
 }
@@ -48,6 +48,27 @@ RHEA_FUNC(thread_condition_signal);
 RHEA_FUNC(thread_condition_broadcast);
 RHEA_FUNC(thread_condition_destroy);
 
+RHEA_FUNC(thread_atomic_create);
+RHEA_FUNC(thread_atomic_load);
+RHEA_FUNC(thread_atomic_store);
+RHEA_FUNC(thread_atomic_fetchAdd);
+RHEA_FUNC(thread_atomic_compareExchange);
+RHEA_FUNC(thread_atomic_min);
+RHEA_FUNC(thread_atomic_max);
+RHEA_FUNC(thread_atomic_destroy);
+
+RHEA_FUNC(thread_channel_create);
+RHEA_FUNC(thread_channel_send);
+RHEA_FUNC(thread_channel_trySend);
+RHEA_FUNC(thread_channel_sendBatch);
+RHEA_FUNC(thread_channel_recv);
+RHEA_FUNC(thread_channel_tryRecv);
+RHEA_FUNC(thread_channel_recvBatch);
+RHEA_FUNC(thread_channel_select);
+RHEA_FUNC(thread_channel_close);
+RHEA_FUNC(thread_channel_isClosed);
+RHEA_FUNC(thread_channel_destroy);
+
 RHEA_LIB_END
 
 #ifdef __clang__
@@ -60,6 +60,7 @@ OUTPUT_LIBRARY = os.path.join(
     'modules', 'core@1.0.0',
     'lib', 'core'
 )
+OUTPUT_IMPORT_LIBRARY = os.path.join('dist', 'librhea.a')
 
 cpp_files = []
 cc_files = []
@@ -291,6 +292,8 @@ def build_proc():
                 config_res,
                 icon_config_res
             ] + cpp_files + [
+                '-Wl,--export-all-symbols',
+                '-Wl,--out-implib,' + OUTPUT_IMPORT_LIBRARY,
                 '-o', OUTPUT_EXECUTABLE
             ] + linkable_libs + win_libs
 
@@ -325,7 +328,9 @@ def build_proc():
                     '-Iinclude', '-Istd', '-shared', '-fopenmp',
                     '-o', OUTPUT_LIBRARY + '.dll',
                     '-Wno-deprecated-declarations'
-                ] + ext_instructions + lib_headers + lib_source_files + cpp_files + cc_files + linkable_libs + win_libs
+                ] + ext_instructions + lib_headers + lib_source_files + cc_files + [
+                    OUTPUT_IMPORT_LIBRARY
+                ] + linkable_libs + win_libs
 
                 log_task("Building Rhea standard library for Windows...")
                 subprocess.run(lib_build_args)
@@ -355,7 +360,7 @@ def build_proc():
                 '-Wunused-value', '-Wunused-variable', '-Wvariadic-macros', '-O2',
                 '-Wvolatile-register-var', '-Wwrite-strings', '-pipe', '-ffast-math', '-s',
                 '-std=c++23', '-fopenmp'] + ext_instructions + ['-march=native',
-                '-ffast-math', '-D__TERMUX__'
+                '-ffast-math', '-D__TERMUX__', '-rdynamic'
             ] + lib_headers + lib_source_files + cpp_files + ['-o', OUTPUT_EXECUTABLE] + linkable_libs
 
             if '--no-core' not in sys.argv:
@@ -372,7 +377,7 @@ def build_proc():
                     'g++', '-Iinclude', '-Istd', '-fPIC', '-D__TERMUX__',
                     '-shared', '-o', OUTPUT_LIBRARY + '.so',
                     '-std=c++23', '-Wno-deprecated-declarations'
-                ] + ext_instructions + lib_headers + lib_source_files + cpp_files + cc_files + [
+                ] + ext_instructions + lib_headers + lib_source_files + cc_files + [
                     '-lcurl'
                 ] + linkable_libs
 
@@ -399,7 +404,7 @@ def build_proc():
                 '-Wunused-value', '-Wunused-variable', '-Wvariadic-macros', '-O2',
                 '-Wvolatile-register-var', '-Wwrite-strings', '-pipe', '-ffast-math', '-s',
                 '-std=c++23', '-fopenmp'] + ext_instructions + [
-                '-march=native', '-ffast-math'
+                '-march=native', '-ffast-math', '-rdynamic'
             ] + lib_headers + lib_source_files + cpp_files + ['-o', OUTPUT_EXECUTABLE] + linkable_libs
 
             if '--no-core' not in sys.argv:
@@ -417,7 +422,7 @@ def build_proc():
                     'g++', '-Iinclude', '-Istd', '-fPIC',
                     '-shared', '-o', OUTPUT_LIBRARY + '.so',
                     '-std=c++23', '-Wno-deprecated-declarations'
-                ] + ext_instructions + lib_headers + lib_source_files + cpp_files + cc_files + linkable_libs
+                ] + ext_instructions + lib_headers + lib_source_files + cc_files + linkable_libs
 
                 log_task("Building Rhea standard library for Linux...")
                 subprocess.run(lib_build_args)
@@ -468,7 +473,9 @@ def build_proc():
                 '-Wwrite-strings', '-Wno-return-type-c-linkage', '-pipe',
                 '-std=c++23', '-ffast-math', '-flto=auto',
                 '-Xpreprocessor', '-O2', '-Wno-header-guard', '-Wno-pessimizing-move'
-            ] + lib_headers + lib_source_files + ['-lc++abi'] + cpp_files + ['-o', OUTPUT_EXECUTABLE]
+            ] + lib_headers + lib_source_files + ['-lc++abi'] + cpp_files + [
+                '-Wl,-export_dynamic', '-o', OUTPUT_EXECUTABLE
+            ]
 
             if '--no-core' not in sys.argv:
                 now = time.time()
@@ -487,8 +494,9 @@ def build_proc():
                     '-Wno-deprecated-declarations', '-DGL_SILENCE_DEPRECATION',
                     '-L/opt/homebrew/lib', '-L/opt/homebrew/opt/openssl@3/lib',
                     '-std=c++23', '-Wno-deprecated-declarations',
-                    '-install_name', '@rpath/core.dylib'
-                ] + ext_instructions + lib_headers + lib_source_files + cpp_files + cc_files + [
+                    '-install_name', '@rpath/core.dylib',
+                    '-undefined', 'dynamic_lookup'
+                ] + ext_instructions + lib_headers + lib_source_files + cc_files + [
                     '-framework', 'OpenGL'
                 ] + linkable_libs
 